@@ -0,0 +1,21 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Generated header include
+#include "NoesisResaveXamlsCommandlet.generated.h"
+
+// Resaves the XAML assets saved before their texture sizes were recorded, so loading them doesn't have to load
+// their textures. Run with -run=NoesisResaveXamls
+UCLASS()
+class NOESISEDITOR_API UNoesisResaveXamlsCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface
+};
@@ -66,6 +66,11 @@ void FNoesisBlueprintCompilerContext::FinishCompilingClass(UClass* Class)
 	NoesisBlueprintGeneratedClass->BaseXaml = NoesisBlueprint->BaseXaml;
 	NoesisBlueprintGeneratedClass->EnablePPAA = NoesisBlueprint->EnablePPAA;
 	NoesisBlueprintGeneratedClass->TessellationQuality = NoesisBlueprint->TessellationQuality;
+	NoesisBlueprintGeneratedClass->RetainedMode = NoesisBlueprint->RetainedMode;
+	NoesisBlueprintGeneratedClass->UpdateMode = NoesisBlueprint->UpdateMode;
+	NoesisBlueprintGeneratedClass->UpdateRate = NoesisBlueprint->UpdateRate;
+	NoesisBlueprintGeneratedClass->LowPriorityUpdate = NoesisBlueprint->LowPriorityUpdate;
+	NoesisBlueprintGeneratedClass->AsyncInit = NoesisBlueprint->AsyncInit;
 }
 
 bool FNoesisBlueprintCompilerContext::ValidateGeneratedClass(UBlueprintGeneratedClass* Class)
@@ -17,6 +17,7 @@
 // NoesisRuntime includes
 #include "NoesisXaml.h"
 #include "NoesisBlueprint.h"
+#include "NoesisRuntimeModule.h"
 
 // NoesisEditor includes
 #include "NoesisBlueprintAssetTypeActions.h"
@@ -105,6 +106,26 @@ void FixPremultipliedPNGTexture(UTexture2D* Texture)
 	}
 }
 
+void UpdateTextureSize(UTexture2D* Texture)
+{
+	FSoftObjectPath TexturePath(Texture);
+	FIntPoint TextureSize(Texture->GetSizeX(), Texture->GetSizeY());
+	INoesisRuntimeModuleInterface::Get().UpdateTextureSize(TexturePath, TextureSize);
+
+	for (TObjectIterator<UNoesisXaml> It; It; ++It)
+	{
+		UNoesisXaml* Xaml = *It;
+		for (int32 Index = 0; Index < Xaml->Textures.Num() && Index < Xaml->TextureSizes.Num(); ++Index)
+		{
+			if (Xaml->Textures[Index].ToSoftObjectPath() == TexturePath && Xaml->TextureSizes[Index] != TextureSize)
+			{
+				Xaml->TextureSizes[Index] = TextureSize;
+				Xaml->MarkPackageDirty();
+			}
+		}
+	}
+}
+
 void OnObjectReimported(UFactory* ImportFactory, UObject* InObject)
 {
 	for (TObjectIterator<UNoesisXaml> It; It; ++It)
@@ -117,6 +138,7 @@ void OnObjectReimported(UFactory* ImportFactory, UObject* InObject)
 	{
 		UTexture2D* Texture = (UTexture2D*)InObject;
 		FixPremultipliedPNGTexture(Texture);
+		UpdateTextureSize(Texture);
 	}
 }
 
@@ -136,6 +158,7 @@ void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& Even
 		{
 			UTexture2D* Texture = (UTexture2D*)Object;
 			FixPremultipliedPNGTexture(Texture);
+			UpdateTextureSize(Texture);
 		}
 		ReentryGuard = 0;
 	}
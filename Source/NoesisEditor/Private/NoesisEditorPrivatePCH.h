@@ -23,6 +23,7 @@
 #include "Kismet/KismetStringLibrary.h"
 #include "EditorFramework/AssetImportData.h"
 #include "Sound/SoundWave.h"
+#include "Commandlets/Commandlet.h"
 
 // UnrealEd includes
 #include "AutomatedAssetImportData.h"
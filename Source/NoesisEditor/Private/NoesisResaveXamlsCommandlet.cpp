@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "NoesisResaveXamlsCommandlet.h"
+
+UNoesisResaveXamlsCommandlet::UNoesisResaveXamlsCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UNoesisResaveXamlsCommandlet::Main(const FString& Params)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetData> XamlAssets;
+	AssetRegistry.GetAssetsByClass(UNoesisXaml::StaticClass()->GetFName(), XamlAssets);
+
+	int32 Resaved = 0;
+	int32 Failed = 0;
+	for (const FAssetData& XamlAsset : XamlAssets)
+	{
+		UNoesisXaml* Xaml = Cast<UNoesisXaml>(XamlAsset.GetAsset());
+		if (!Xaml || Xaml->TextureSizes.Num() == Xaml->Textures.Num())
+			continue;
+
+		// PreSave records the texture sizes
+		UPackage* Package = Xaml->GetOutermost();
+		FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (UPackage::SavePackage(Package, nullptr, RF_Standalone, *Filename, GError, nullptr, false, true, SAVE_NoError))
+		{
+			UE_LOG(LogNoesisEditor, Display, TEXT("Resaved %s"), *Filename);
+			++Resaved;
+		}
+		else
+		{
+			UE_LOG(LogNoesisEditor, Error, TEXT("Failed to resave %s"), *Filename);
+			++Failed;
+		}
+
+		CollectGarbage(RF_NoFlags);
+	}
+
+	UE_LOG(LogNoesisEditor, Display, TEXT("Resaved %d of %d XAML assets"), Resaved, XamlAssets.Num());
+	return Failed == 0 ? 0 : 1;
+}
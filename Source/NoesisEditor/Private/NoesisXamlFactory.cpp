@@ -335,6 +335,10 @@ UObject* UNoesisXamlFactory::FactoryCreateBinary(UClass* Class, UObject* Parent,
 
 	NoesisXaml->XamlText.Insert((uint8*)Text.Str(), Text.Size(), 0);
 
+	NoesisXaml->UpdateTextureSizes();
+	NoesisXaml->UpdateGlyphSets();
+	NoesisXaml->RegisterTextureSizes();
+
 	NoesisXaml->LoadXaml();
 
 	NoesisXaml->AssetImportData->Update(FullFilePath);
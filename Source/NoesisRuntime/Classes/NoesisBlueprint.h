@@ -22,6 +22,19 @@ enum class ENoesisTessellationQuality : uint8
 	High,
 };
 
+UENUM(BlueprintType)
+enum class ENoesisUpdateMode : uint8
+{
+	/** Updates the view every tick. */
+	EveryFrame,
+	/** Updates the view UpdateRate times per second. */
+	FixedRate,
+	/** Updates the view only while it was drawn inside its clip rect with a non zero opacity, including the opacity of its parents. */
+	WhenVisible,
+	/** Updates the view only after input, a binding change or a resize. A non zero UpdateRate keeps animations running at that rate. */
+	OnInputOrChange,
+};
+
 UCLASS()
 class NOESISRUNTIME_API UNoesisBlueprint : public UBlueprint
 {
@@ -45,4 +58,24 @@ class NOESISRUNTIME_API UNoesisBlueprint : public UBlueprint
 	/** Specifies tessellation quality. */
 	UPROPERTY(EditAnywhere, Category = "Noesis View")
 	ENoesisTessellationQuality TessellationQuality;
+
+	/** Renders the view into a cached texture that is only redrawn when something changes. Useful for panels that stay static for long periods. */
+	UPROPERTY(EditAnywhere, Category = "Noesis View")
+	bool RetainedMode;
+
+	/** Controls how often the view is updated. */
+	UPROPERTY(EditAnywhere, Category = "Noesis View")
+	ENoesisUpdateMode UpdateMode;
+
+	/** Updates per second in FixedRate mode, idle updates per second in OnInputOrChange mode. */
+	UPROPERTY(EditAnywhere, Category = "Noesis View", meta = (ClampMin = 0, UIMin = 0))
+	float UpdateRate;
+
+	/** Low priority views share the per-frame update budget from the project settings and are updated round-robin when it runs out. */
+	UPROPERTY(EditAnywhere, Category = "Noesis View")
+	bool LowPriorityUpdate;
+
+	/** Prefetches the XAML dependencies asynchronously when the widget is created, instead of blocking the game thread on their loads. The XAML is still parsed on the game thread once they are loaded, and the view shows up then. */
+	UPROPERTY(EditAnywhere, Category = "Noesis View")
+	bool AsyncInit;
 };
@@ -30,4 +30,19 @@ class NOESISRUNTIME_API UNoesisBlueprintGeneratedClass : public UBlueprintGenera
 
 	UPROPERTY()
 	ENoesisTessellationQuality TessellationQuality;
+
+	UPROPERTY()
+	bool RetainedMode;
+
+	UPROPERTY()
+	ENoesisUpdateMode UpdateMode;
+
+	UPROPERTY()
+	float UpdateRate;
+
+	UPROPERTY()
+	bool LowPriorityUpdate;
+
+	UPROPERTY()
+	bool AsyncInit;
 };
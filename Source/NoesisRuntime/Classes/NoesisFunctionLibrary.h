@@ -32,6 +32,9 @@ class NOESISRUNTIME_API UNoesisFunctionLibrary : public UBlueprintFunctionLibrar
 	UFUNCTION(BlueprintCallable, Category = "NoesisGUI", meta = (HidePin = "Target"))
 	static UObject* LoadXaml(class UNoesisXaml* Xaml);
 
+	UFUNCTION(BlueprintCallable, Category = "NoesisGUI", meta = (HidePin = "Target"))
+	static void PrewarmGlyphs(class UNoesisXaml* Xaml);
+
 	UFUNCTION(BlueprintCallable, CustomThunk, meta = (BlueprintInternalUseOnly = "true", CustomStructureParam = "A, B"), Category = "Noesis|Struct")
 	static bool NoesisStruct_NotEqual(const FGenericStruct& A, const FGenericStruct& B);
 
@@ -86,4 +89,9 @@ class NOESISRUNTIME_API UNoesisFunctionLibrary : public UBlueprintFunctionLibrar
 	static void NoesisArray_Set(const TArray<int32>& TargetArray, int32 Index, const int32& Item, bool bSizeToFit);
 
 	DECLARE_FUNCTION(execNoesisArray_Set);
+
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Swap Array Elements w/ NotifyArrayChanged", CompactNodeTitle = "SWAP\nw/ NotifyArrayChanged", ArrayParm = "TargetArray"), Category="Noesis|Array")
+	static void NoesisArray_Swap(const TArray<int32>& TargetArray, int32 FirstIndex, int32 SecondIndex);
+
+	DECLARE_FUNCTION(execNoesisArray_Swap);
 };
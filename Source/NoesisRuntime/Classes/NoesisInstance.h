@@ -14,6 +14,9 @@
 // UMG includes
 #include "Components/Widget.h"
 
+// SlateCore includes
+#include "Styling/SlateBrush.h"
+
 // Noesis includes
 #include "NoesisSDK.h"
 
@@ -23,6 +26,8 @@
 // Generated header include
 #include "NoesisInstance.generated.h"
 
+struct FStreamableHandle;
+
 UENUM()
 enum class NoesisInstanceRenderFlags : uint8
 {
@@ -32,6 +37,8 @@ enum class NoesisInstanceRenderFlags : uint8
 	Overdraw = 4
 };
 
+DECLARE_DYNAMIC_DELEGATE(FNoesisInstanceInitialized);
+
 UCLASS(Blueprintable)
 class NOESISRUNTIME_API UNoesisInstance : public UUserWidget
 {
@@ -61,9 +68,70 @@ class NOESISRUNTIME_API UNoesisInstance : public UUserWidget
 	UPROPERTY(BlueprintReadWrite, Category = "NoesisGUI")
 	NoesisInstanceRenderFlags RenderFlags;
 
+	UPROPERTY(BlueprintReadWrite, Category = "NoesisGUI")
+	bool RetainedMode;
+
+	UPROPERTY(Transient)
+	class UTextureRenderTarget2D* RetainedRenderTarget;
+
+	FSlateBrush RetainedBrush;
+
+	void UpdateRetainedRenderTarget();
+
+	UPROPERTY(BlueprintReadWrite, Category = "NoesisGUI")
+	ENoesisUpdateMode UpdateMode;
+
+	UPROPERTY(BlueprintReadWrite, Category = "NoesisGUI", meta = (ClampMin = 0, UIMin = 0))
+	float UpdateRate;
+
+	UPROPERTY(BlueprintReadWrite, Category = "NoesisGUI")
+	bool LowPriorityUpdate;
+
+	double LastUpdateTime;
+	uint64 LastUpdateFrame;
+	int32 LastViewChangeCount;
+	bool UpdatePending;
+
+	// Changes notified to the objects this view is bound to, woken up by them in OnInputOrChange mode
+	TSharedPtr<class FNoesisViewChanges, ESPMode::ThreadSafe> ViewChanges;
+
+	// Time the last low priority update took, and whether the instance is waiting for budget
+	double LowPriorityUpdateSeconds;
+	bool LowPriorityUpdateDeferred;
+
+	// Whether the last paint was on screen with a non zero opacity, for WhenVisible mode
+	mutable uint64 LastPaintFrame;
+	mutable bool LastPaintVisible;
+
+	float AppliedWidth;
+	float AppliedHeight;
+	uint8 AppliedTessellationQuality;
+	uint32 AppliedFlags;
+
+	void InvalidateViewState();
+	void ApplyViewState();
+	void FinishUpdate();
+
+	bool ShouldUpdate(float InWidth, float InHeight);
+
 	UFUNCTION(BlueprintCallable, Category = "NoesisGUI")
 	void InitInstance();
 
+	// Prefetches the XAML dependencies without blocking. Only their loads are asynchronous, once they are in the XAML is
+	// parsed and the view created on the game thread
+	UFUNCTION(BlueprintCallable, Category = "NoesisGUI")
+	void InitInstanceAsync(const FNoesisInstanceInitialized& OnInitialized);
+
+	bool ResolveBaseXaml();
+	void CreateView();
+
+	// Incremented by every (re)initialization and TermInstance, so stale async initializations are discarded
+	uint32 AsyncInitSerial;
+
+	// Keeps the prefetched dependencies loaded while the view lives, textures are only referenced softly by the XAML
+	TSharedPtr<FStreamableHandle> DependenciesHandle;
+	void ReleaseDependencies();
+
 	UFUNCTION(BlueprintImplementableEvent, Category = "NoesisGUI")
 	void EventInitInstance();
 
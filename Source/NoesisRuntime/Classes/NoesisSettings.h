@@ -80,10 +80,18 @@ class NOESISRUNTIME_API UNoesisSettings : public UObject
 	UPROPERTY(EditAnywhere, Config, Category = "XAML")
 	ENoesisFontStyle DefaultFontStyle;
 
+	/** Memory in KB kept by the XAML parsed as templates, so views created repeatedly from the same XAML are cloned instead of parsed again. Least recently used templates are evicted first. XAMLs with x:Class, or whose names FindName can't reach in the cloned root, are always parsed. 0 disables the cache. */
+	UPROPERTY(EditAnywhere, Config, Category = "XAML", meta = (ClampMin = 0, UIMin = 0))
+	int32 XamlTemplateCacheBudget;
+
 	/** Dimensions of texture used to cache glyphs. */
 	UPROPERTY(EditAnywhere, Config, Category = "Rendering", meta = (ConfigRestartRequired = true))
 	ENoesisGlyphCacheDimensions GlyphTextureSize;
 
+	/** Characters assumed for text that comes from bindings or resources when recording the glyphs used by a XAML. Add the characters of every language the UI is localized to so PrewarmGlyphs covers them. */
+	UPROPERTY(EditAnywhere, Config, Category = "Rendering")
+	FString GlyphPrewarmBoundCharacters;
+
 	/** Multisampling of offscreen textures. */
 	UPROPERTY(EditAnywhere, Config, Category = "Rendering", DisplayName="Offscreen Sample Count", meta = (ConfigRestartRequired = true))
 	ENoesisOffscreenSampleCount OffscreenTextureSampleCount;
@@ -104,6 +112,14 @@ class NOESISRUNTIME_API UNoesisSettings : public UObject
 	UPROPERTY(EditAnywhere, Config, Category = "Rendering", meta = (ConfigRestartRequired = true, ClampMin = 0, UIMin = 0))
 	int32 OffscreenTextureHeight;
 
+	/** Memory budget in MB for render targets and depth-stencil surfaces kept for reuse (0 = unlimited). */
+	UPROPERTY(EditAnywhere, Config, Category = "Rendering", meta = (ConfigRestartRequired = true, ClampMin = 0, UIMin = 0))
+	int32 RenderTargetPoolBudget;
+
+	/** Time in milliseconds that low priority views may spend updating each frame. Views over budget are updated in later frames, stalest first. 0 means unlimited. */
+	UPROPERTY(EditAnywhere, Config, Category = "Rendering", meta = (ClampMin = 0, UIMin = 0))
+	float LowPriorityUpdateBudget;
+
 	/** Maximum number of offscreen textures (0 = unlimited). */
 	UPROPERTY(EditAnywhere, Config, Category = "Editor Settings")
 	ENoesisLoggingSettings LogVerbosity;
@@ -8,12 +8,41 @@
 // Core includes
 #include "CoreMinimal.h"
 
+// CoreUObject includes
+#include "UObject/SoftObjectPtr.h"
+
 // Noesis includes
 #include "NoesisSDK.h"
 
 // Generated header include
 #include "NoesisXaml.generated.h"
 
+// Characters shown with a given font, recorded at save time so they can be rasterized before the XAML is displayed
+USTRUCT()
+struct FNoesisGlyphSet
+{
+	GENERATED_USTRUCT_BODY()
+
+	// Values as written in the XAML. Empty when not specified, so the inherited defaults are used
+	UPROPERTY()
+	FString FontFamily;
+
+	UPROPERTY()
+	FString FontWeight;
+
+	UPROPERTY()
+	FString FontStyle;
+
+	// 0 when not specified
+	UPROPERTY()
+	float FontSize;
+
+	UPROPERTY()
+	FString Characters;
+
+	FNoesisGlyphSet() : FontSize(0.f) {}
+};
+
 UCLASS(BlueprintType)
 class NOESISRUNTIME_API UNoesisXaml : public UObject
 {
@@ -25,8 +54,14 @@ class NOESISRUNTIME_API UNoesisXaml : public UObject
 	UPROPERTY()
 	TArray<UNoesisXaml*> Xamls;
 
+	// Soft, so textures are only loaded when an image is rendered, or streamed in by InitInstanceAsync
+	UPROPERTY()
+	TArray<TSoftObjectPtr<class UTexture2D> > Textures;
+
+	// Size of each texture in Textures, registered with the TextureProvider so images can be measured
+	// without loading their textures
 	UPROPERTY()
-	TArray<class UTexture2D*> Textures;
+	TArray<FIntPoint> TextureSizes;
 
 	UPROPERTY()
 	TArray<class UFont*> Fonts;
@@ -34,24 +69,49 @@ class NOESISRUNTIME_API UNoesisXaml : public UObject
 	UPROPERTY()
 	TArray<class USoundWave*> Sounds;
 
+	// Fonts and characters used by the text in the XAML
+	UPROPERTY()
+	TArray<FNoesisGlyphSet> GlyphSets;
+
 	Noesis::Ptr<Noesis::BaseComponent> LoadXaml();
 	void LoadComponent(Noesis::BaseComponent* Component);
 	uint32 GetContentHash() const;
 
+	// Creates a new root element. XAMLs that can be used as templates are parsed once and cloned afterwards
+	Noesis::Ptr<Noesis::FrameworkElement> InstantiateXaml();
+
+	// Text served by the XamlProvider for the given path, either the XAML itself or its template version
+	const TArray<uint8>& GetProviderText(const FString& ProviderPath) const;
+
+	static void ClearTemplateCache();
+
+	// Rasterizes the glyphs in GlyphSets, and in the ones of the XAMLs this one depends on, into the glyph cache.
+	// Meant to be called while a loading screen is shown, so text doesn't hitch the first time it's displayed
+	void PrewarmGlyphs();
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(VisibleAnywhere, Instanced, Category=ImportSettings)
 	class UAssetImportData* AssetImportData;
 
+	void UpdateTextureSizes();
+	void UpdateGlyphSets();
+
 	// UObject interface
 	virtual void PostInitProperties() override;
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
 	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
 	// End of UObject interface
 #endif
 
 	// UObject interface
+	virtual void Serialize(FArchive& Ar) override;
 	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
 	// End of UObject interface
 
+	void RegisterTextureSizes();
+	void UnregisterTextureSizes();
+
 #if WITH_EDITOR
 	void PreloadDependencies();
 
@@ -64,4 +124,16 @@ class NOESISRUNTIME_API UNoesisXaml : public UObject
 	UPROPERTY()
 	class UNoesisInstance* ThumbnailRenderInstance;
 #endif
+
+private:
+	Noesis::Ptr<Noesis::FrameworkTemplate> LoadTemplate(int64& OutSize);
+	void CollectGlyphXamls(TArray<UNoesisXaml*>& OutXamls, TSet<UNoesisXaml*>& Visited);
+	bool GetGlyphsPass(int32 Pass, TArray<FNoesisGlyphSet>& OutGlyphSets) const;
+	Noesis::Ptr<Noesis::BaseComponent> LoadGlyphsXaml(const TArray<FNoesisGlyphSet>& PassGlyphSets);
+
+	TArray<uint8> TemplateText;
+	TArray<uint8> GlyphsText;
+
+	// Textures whose sizes this XAML holds a registration for
+	TArray<FSoftObjectPath> RegisteredTextureSizes;
 };
@@ -14,6 +14,8 @@ UNoesisBlueprint::UNoesisBlueprint(const FObjectInitializer& ObjectInitializer)
 	bRecompileOnLoad = false;
 
 	TessellationQuality = ENoesisTessellationQuality::Medium;
+	UpdateMode = ENoesisUpdateMode::EveryFrame;
+	UpdateRate = 30.0f;
 }
 
 #if WITH_EDITOR
@@ -53,6 +53,14 @@ UObject*UNoesisFunctionLibrary::LoadXaml(class UNoesisXaml* Xaml)
 	return NoesisCreateUObjectForComponent(Xaml->LoadXaml().GetPtr());
 }
 
+void UNoesisFunctionLibrary::PrewarmGlyphs(class UNoesisXaml* Xaml)
+{
+	if (Xaml)
+	{
+		Xaml->PrewarmGlyphs();
+	}
+}
+
 DEFINE_FUNCTION(UNoesisFunctionLibrary::execNoesisStruct_NotEqual)
 {
 	Stack.StepCompiledIn<UStructProperty>(NULL);
@@ -150,8 +158,25 @@ DEFINE_FUNCTION(UNoesisFunctionLibrary::execNoesisArray_Shuffle)
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-	UKismetArrayLibrary::GenericArray_Shuffle(ArrayAddr, ArrayProperty);
-	NoesisNotifyArrayPropertyPostChanged(ArrayAddr);
+	// Same Fisher-Yates shuffle as GenericArray_Shuffle, tracking the permutation so it can be notified as moves
+	FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayAddr);
+	int32 LastIndex = ArrayHelper.Num() - 1;
+	TArray<int32> NewToOldIndices;
+	NewToOldIndices.SetNumUninitialized(ArrayHelper.Num());
+	for (int32 Index = 0; Index <= LastIndex; ++Index)
+	{
+		NewToOldIndices[Index] = Index;
+	}
+	for (int32 Index = 0; Index <= LastIndex; ++Index)
+	{
+		int32 SwapIndex = FMath::RandRange(Index, LastIndex);
+		if (Index != SwapIndex)
+		{
+			ArrayHelper.SwapValues(Index, SwapIndex);
+			NewToOldIndices.Swap(Index, SwapIndex);
+		}
+	}
+	NoesisNotifyArrayPropertyPostReorder(ArrayAddr, NewToOldIndices);
 	P_NATIVE_END;
 }
 
@@ -329,11 +354,11 @@ DEFINE_FUNCTION(UNoesisFunctionLibrary::execNoesisArray_Resize)
 	const UProperty* InnerProp = ArrayProperty->Inner;
 	FScriptArrayHelper ArrayHelper = FScriptArrayHelper::CreateHelperFormInnerProperty(InnerProp, ArrayAddr);
 	int32 ArrayNum = ArrayHelper.Num();
-	for (int32 Index = ArrayNum; Index-- > Size;)
+	if (Size >= 0 && Size < ArrayNum)
 	{
-		NoesisNotifyArrayPropertyPreRemove(ArrayAddr, Index);
-		UKismetArrayLibrary::GenericArray_Remove(ArrayAddr, ArrayProperty, Index);
-		NoesisNotifyArrayPropertyPostRemove(ArrayAddr, Index);
+		NoesisNotifyArrayPropertyPreRemoveRange(ArrayAddr, Size, ArrayNum - Size);
+		UKismetArrayLibrary::GenericArray_Resize(ArrayAddr, ArrayProperty, Size);
+		NoesisNotifyArrayPropertyPostRemoveRange(ArrayAddr, Size);
 	}
 	if (Size > ArrayNum)
 	{
@@ -388,3 +413,28 @@ DEFINE_FUNCTION(UNoesisFunctionLibrary::execNoesisArray_Set)
 	P_NATIVE_END;
 	InnerProp->DestroyValue(StorageSpace);
 }
+
+DEFINE_FUNCTION(UNoesisFunctionLibrary::execNoesisArray_Swap)
+{
+	Stack.MostRecentProperty = nullptr;
+	Stack.StepCompiledIn<UArrayProperty>(NULL);
+	void* ArrayAddr = Stack.MostRecentPropertyAddress;
+	UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Stack.MostRecentProperty);
+	if (!ArrayProperty)
+	{
+		Stack.bArrayContextFailed = true;
+		return;
+	}
+
+	P_GET_PROPERTY(UIntProperty, FirstIndex);
+	P_GET_PROPERTY(UIntProperty, SecondIndex);
+	P_FINISH;
+	P_NATIVE_BEGIN;
+	FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayAddr);
+	if (ArrayHelper.IsValidIndex(FirstIndex) && ArrayHelper.IsValidIndex(SecondIndex))
+	{
+		UKismetArrayLibrary::GenericArray_Swap(ArrayAddr, ArrayProperty, FirstIndex, SecondIndex);
+		NoesisNotifyArrayPropertyPostSwap(ArrayAddr, FirstIndex, SecondIndex);
+	}
+	P_NATIVE_END;
+}
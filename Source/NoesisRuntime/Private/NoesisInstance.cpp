@@ -11,6 +11,10 @@
 
 // Engine includes
 #include "SceneUtils.h"
+#include "Engine/Font.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/Texture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
 
 // RenderCore includes
 #include "RenderingThread.h"
@@ -33,10 +37,16 @@
 #include "NoesisTypeClass.h"
 #include "NoesisXaml.h"
 #include "NoesisSupport.h"
+#include "NoesisSettings.h"
 
 DECLARE_CYCLE_STAT(TEXT("NoesisInstance::Update"), STAT_NoesisInstance_Update, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisInstance::UpdatesSkipped"), STAT_NoesisInstance_UpdatesSkipped, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisInstance::UpdatesDeferred"), STAT_NoesisInstance_UpdatesDeferred, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisInstance::DrawOffscreen_RenderThread"), STAT_NoesisInstance_DrawOffscreen, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisInstance::Draw_RenderThread"), STAT_NoesisInstance_Draw, STATGROUP_Noesis);
+DECLARE_CYCLE_STAT(TEXT("NoesisInstance::DrawRetained_RenderThread"), STAT_NoesisInstance_DrawRetained, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisInstance::RetainedFramesRendered"), STAT_NoesisInstance_RetainedFramesRendered, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisInstance::RetainedFramesSkipped"), STAT_NoesisInstance_RetainedFramesSkipped, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisInstance::NativeOnKeyChar"), STAT_NoesisInstance_OnKeyChar, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisInstance::NativeOnKeyDown"), STAT_NoesisInstance_OnKeyDown, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisInstance::NativeOnKeyUp"), STAT_NoesisInstance_OnKeyUp, STATGROUP_Noesis);
@@ -101,8 +111,11 @@ public:
 	virtual void DrawRenderThread(FRHICommandListImmediate& RHICmdList, const void* InWindowBackBuffer) override;
 	// End of ICustomSlateElement interface
 
+	void DrawRetainedRenderThread(FRHICommandListImmediate& RHICmdList, FTextureRenderTargetResource* RenderTargetResource);
+
 	Noesis::Ptr<Noesis::IRenderer> Renderer;
 	FTexture2DRHIRef DepthStencilTarget;
+	FTexture2DRHIRef RetainedTarget;
 
 	float Left;
 	float Top;
@@ -124,16 +137,9 @@ void FNoesisSlateElement::DrawRenderThread(FRHICommandListImmediate& RHICmdList,
 
 		if (!DepthStencilTarget.IsValid() || DepthStencilTarget->GetSizeX() != ColorTarget->GetSizeX() || DepthStencilTarget->GetSizeY() != ColorTarget->GetSizeY() || DepthStencilTarget->GetNumSamples() != ColorTarget->GetNumSamples())
 		{
+			// Return the old surface to the pool before asking for a new one
 			DepthStencilTarget.SafeRelease();
-			uint32 SizeX = ColorTarget->GetSizeX();
-			uint32 SizeY = ColorTarget->GetSizeY();
-			uint8 Format = (uint8)PF_DepthStencil;
-			uint32 NumMips = 1;
-			uint32 NumSamples = ColorTarget->GetNumSamples();
-			uint32 TargetableTextureFlags = (uint32)TexCreate_DepthStencilTargetable;
-			FRHIResourceCreateInfo CreateInfo;
-			CreateInfo.ClearValueBinding = FClearValueBinding(0.f, 0);
-			DepthStencilTarget = RHICreateTexture2D(SizeX, SizeY, Format, NumMips, NumSamples, TargetableTextureFlags, CreateInfo);
+			DepthStencilTarget = FNoesisRenderDevice::Get()->RenderTargetPool.FindFreeDepthStencil(ColorTarget->GetSizeX(), ColorTarget->GetSizeY(), ColorTarget->GetNumSamples());
 		}
 		// Clear the stencil buffer
 		FRHIRenderPassInfo RPInfo(ColorTarget, ERenderTargetActions::Load_Store, DepthStencilTarget,
@@ -151,6 +157,47 @@ void FNoesisSlateElement::DrawRenderThread(FRHICommandListImmediate& RHICmdList,
 		RHICmdList.EndRenderPass();
 	}
 }
+
+void FNoesisSlateElement::DrawRetainedRenderThread(FRHICommandListImmediate& RHICmdList, FTextureRenderTargetResource* RenderTargetResource)
+{
+	if (Renderer && RenderTargetResource)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_DrawRetained);
+		FNoesisRenderDevice::ThreadLocal_SetRHICmdList(&RHICmdList);
+
+		// The cached texture is only redrawn if the render tree changed or the texture was recreated
+		bool Changed = Renderer->UpdateRenderTree();
+		FTexture2DRHIRef ColorTarget = RenderTargetResource->GetRenderTargetTexture();
+		if (Changed || RetainedTarget != ColorTarget)
+		{
+			SCOPED_DRAW_EVENT(RHICmdList, NoesisDrawRetained);
+			RetainedTarget = ColorTarget;
+			Renderer->RenderOffscreen();
+
+			uint32 SizeX = ColorTarget->GetSizeX();
+			uint32 SizeY = ColorTarget->GetSizeY();
+			FTexture2DRHIRef RetainedDepthStencilTarget = FNoesisRenderDevice::Get()->RenderTargetPool.FindFreeDepthStencil(SizeX, SizeY, ColorTarget->GetNumSamples());
+			FRHIRenderPassInfo RPInfo(ColorTarget, ERenderTargetActions::Clear_Store, RetainedDepthStencilTarget,
+				MakeDepthStencilTargetActions(ERenderTargetActions::DontLoad_DontStore, ERenderTargetActions::Clear_DontStore), FExclusiveDepthStencil::DepthNop_StencilWrite);
+
+			check(RHICmdList.IsOutsideRenderPass());
+			RHICmdList.BeginRenderPass(RPInfo, TEXT("NoesisRetained"));
+			RHICmdList.SetViewport(0, 0, 0.0f, SizeX, SizeY, 1.0f);
+			Renderer->Render(false);
+			RHICmdList.EndRenderPass();
+
+			RHICmdList.CopyToResolveTarget(ColorTarget, RenderTargetResource->TextureRHI, FResolveParams());
+			INC_DWORD_STAT(STAT_NoesisInstance_RetainedFramesRendered);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_NoesisInstance_RetainedFramesSkipped);
+		}
+
+		FNoesisRenderDevice::ThreadLocal_SetRHICmdList(nullptr);
+	}
+}
+
 class NoesisTextBoxTextInputMethodContext : public ITextInputMethodContext
 {
 public:
@@ -284,17 +331,81 @@ private:
 	UNoesisInstance* NoesisInstance;
 };
 
+// Per-frame time budget shared by low priority instances. Instances that don't fit are deferred, and on the
+// next frame the time they took last is set aside for them, so the others only get what is left after that.
+// Updates run on the game thread inside the tick, so their time is charged to the frame they ran in
+struct FNoesisUpdateBudget
+{
+	uint64 FrameCounter = 0;
+	double SpentSeconds = 0.0;
+	double ReservedSeconds = 0.0;
+	double NextReservedSeconds = 0.0;
+
+	void BeginFrame()
+	{
+		check(IsInGameThread());
+		if (FrameCounter != GFrameCounter)
+		{
+			FrameCounter = GFrameCounter;
+			SpentSeconds = 0.0;
+			ReservedSeconds = NextReservedSeconds;
+			NextReservedSeconds = 0.0;
+		}
+	}
+
+	bool TryAcquire(bool Deferred, double EstimatedSeconds)
+	{
+		BeginFrame();
+
+		double BudgetSeconds = GetDefault<UNoesisSettings>()->LowPriorityUpdateBudget / 1000.0;
+		if (BudgetSeconds <= 0.0)
+			return true;
+
+		bool Fits = SpentSeconds == 0.0 || SpentSeconds + (Deferred ? 0.0 : ReservedSeconds) < BudgetSeconds;
+		if (!Fits)
+		{
+			NextReservedSeconds += EstimatedSeconds;
+			return false;
+		}
+
+		if (Deferred)
+		{
+			ReservedSeconds = FMath::Max(ReservedSeconds - EstimatedSeconds, 0.0);
+		}
+		return true;
+	}
+
+	void Spend(double Seconds)
+	{
+		BeginFrame();
+		SpentSeconds += Seconds;
+	}
+};
+
+static FNoesisUpdateBudget LowPriorityUpdateBudget;
+
 UNoesisInstance::UNoesisInstance(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	Visibility = ESlateVisibility::Visible;
+	UpdateMode = ENoesisUpdateMode::EveryFrame;
+	UpdateRate = 30.0f;
+	LowPriorityUpdate = false;
+	AsyncInitSerial = 0;
+	LastUpdateTime = 0.0;
+	LastUpdateFrame = 0;
+	LastViewChangeCount = 0;
+	UpdatePending = true;
+	ViewChanges = MakeShared<FNoesisViewChanges, ESPMode::ThreadSafe>();
+	LowPriorityUpdateSeconds = 0.0;
+	LowPriorityUpdateDeferred = false;
+	LastPaintFrame = 0;
+	LastPaintVisible = false;
+	InvalidateViewState();
 }
 
-void UNoesisInstance::InitInstance()
+bool UNoesisInstance::ResolveBaseXaml()
 {
-	ULocalPlayer* Player = 0;
-	int32 ZOrder = 0;
-
 	if (!BaseXaml)
 	{
 		UNoesisBlueprintGeneratedClass* NoesisBlueprintGeneratedClass = CastChecked<UNoesisBlueprintGeneratedClass>(GetClass());
@@ -302,16 +413,107 @@ void UNoesisInstance::InitInstance()
 		BaseXaml = NoesisBlueprintGeneratedClass->BaseXaml;
 		EnablePPAA = NoesisBlueprintGeneratedClass->EnablePPAA;
 		TessellationQuality = NoesisBlueprintGeneratedClass->TessellationQuality;
+		RetainedMode = NoesisBlueprintGeneratedClass->RetainedMode;
+		UpdateMode = NoesisBlueprintGeneratedClass->UpdateMode;
+		UpdateRate = NoesisBlueprintGeneratedClass->UpdateRate;
+		LowPriorityUpdate = NoesisBlueprintGeneratedClass->LowPriorityUpdate;
+	}
+
+	return BaseXaml != nullptr;
+}
+
+void UNoesisInstance::InitInstance()
+{
+	++AsyncInitSerial;
+	ReleaseDependencies();
+
+	if (!ResolveBaseXaml())
+		return;
+
+	SetApplicationResources();
+	Xaml = BaseXaml->InstantiateXaml();
+
+	CreateView();
+}
+
+static FStreamableManager& GetNoesisStreamableManager()
+{
+	static FStreamableManager StreamableManager;
+	return StreamableManager;
+}
+
+static void CollectXamlDependencies(UNoesisXaml* Xaml, TSet<UNoesisXaml*>& Visited, TArray<FSoftObjectPath>& Dependencies)
+{
+	if (Xaml == nullptr || Visited.Contains(Xaml))
+		return;
+
+	Visited.Add(Xaml);
+	Dependencies.Add(FSoftObjectPath(Xaml));
+	for (auto Dependency : Xaml->Xamls)
+	{
+		CollectXamlDependencies(Dependency, Visited, Dependencies);
+	}
+	for (auto& Texture : Xaml->Textures)
+	{
+		if (!Texture.IsNull())
+		{
+			Dependencies.Add(Texture.ToSoftObjectPath());
+		}
+	}
+	for (auto Font : Xaml->Fonts)
+	{
+		if (Font)
+		{
+			Dependencies.Add(FSoftObjectPath(Font));
+		}
+	}
+}
+
+void UNoesisInstance::InitInstanceAsync(const FNoesisInstanceInitialized& OnInitialized)
+{
+	uint32 Serial = ++AsyncInitSerial;
+	ReleaseDependencies();
 
-		if (!BaseXaml)
+	if (!ResolveBaseXaml())
+	{
+		OnInitialized.ExecuteIfBound();
+		return;
+	}
+
+	TArray<FSoftObjectPath> Dependencies;
+	TSet<UNoesisXaml*> Visited;
+	CollectXamlDependencies(BaseXaml, Visited, Dependencies);
+
+	TWeakObjectPtr<UNoesisInstance> WeakThis(this);
+	DependenciesHandle = GetNoesisStreamableManager().RequestAsyncLoad(Dependencies, [WeakThis, Serial, OnInitialized]()
+	{
+		UNoesisInstance* Instance = WeakThis.Get();
+		if (Instance == nullptr || Instance->AsyncInitSerial != Serial || Instance->XamlView)
 			return;
+
+		// Parsing registers the types the XAML uses, which loads UObjects and fills them from reflection, so
+		// it stays on the game thread. With everything streamed in, it doesn't block on loads anymore
+		check(IsInGameThread());
+		SetApplicationResources();
+		Instance->Xaml = Instance->BaseXaml->InstantiateXaml();
+		Instance->CreateView();
+		OnInitialized.ExecuteIfBound();
+	});
+}
+
+void UNoesisInstance::ReleaseDependencies()
+{
+	if (DependenciesHandle.IsValid())
+	{
+		DependenciesHandle->ReleaseHandle();
+		DependenciesHandle.Reset();
 	}
+}
 
+void UNoesisInstance::CreateView()
+{
 	Noesis::Ptr<Noesis::BaseComponent> DataContext = Noesis::Ptr<Noesis::BaseComponent>(NoesisCreateComponentForUObject(this));
 
-	SetApplicationResources();
-	Xaml.Reset(Noesis::DynamicCast<Noesis::FrameworkElement*>(BaseXaml->LoadXaml().GetPtr()));
-
 	if (Xaml)
 	{
 		Xaml->SetDataContext(DataContext.GetPtr());
@@ -333,6 +535,7 @@ void UNoesisInstance::InitInstance()
 			NoesisSlateElement = MakeShared<FNoesisSlateElement, ESPMode::ThreadSafe>(Renderer);
 
 			StartTime = GetTimeSeconds();
+			InvalidateViewState();
 
 			EventInitInstance();
 
@@ -351,6 +554,7 @@ void UNoesisInstance::SetDataContext(UObject* InDataContext)
 		Noesis::Ptr<Noesis::BaseComponent> DataContext = Noesis::Ptr<Noesis::BaseComponent>(NoesisCreateComponentForUObject(InDataContext));
 
 		Xaml->SetDataContext(DataContext.GetPtr());
+		UpdatePending = true;
 	}
 }
 
@@ -416,8 +620,27 @@ void UNoesisInstance::Update(float InLeft, float InTop, float InWidth, float InH
 	Width = InWidth;
 	Height = InHeight;
 	if (Xaml && XamlView)
+	{
+		FNoesisViewChanges* PreviousViewChanges = NoesisSetCurrentViewChanges(ViewChanges.Get());
+		NoesisFlushPropertyChanges();
+		ApplyViewState();
+		XamlView->Update(GetTimeSeconds() - StartTime);
+		NoesisSetCurrentViewChanges(PreviousViewChanges);
+		FinishUpdate();
+	}
+}
+
+void UNoesisInstance::ApplyViewState()
+{
+	// Only forward view state that actually changed since the last update
+	if (Width != AppliedWidth || Height != AppliedHeight)
 	{
 		XamlView->SetSize(Width, Height);
+		AppliedWidth = Width;
+		AppliedHeight = Height;
+	}
+	if ((uint8)TessellationQuality != AppliedTessellationQuality)
+	{
 		Noesis::TessellationMaxPixelError mpe = Noesis::TessellationMaxPixelError::MediumQuality();
 		switch (TessellationQuality)
 		{
@@ -432,11 +655,72 @@ void UNoesisInstance::Update(float InLeft, float InTop, float InWidth, float InH
 			break;
 		}
 		XamlView->SetTessellationMaxPixelError(mpe);
-		XamlView->SetFlags((uint32)RenderFlags | (EnablePPAA ? Noesis::RenderFlags_PPAA : 0));
-		XamlView->Update(GetTimeSeconds() - StartTime);
+		AppliedTessellationQuality = (uint8)TessellationQuality;
+	}
+	uint32 Flags = (uint32)RenderFlags | (EnablePPAA ? Noesis::RenderFlags_PPAA : 0);
+	if (Flags != AppliedFlags)
+	{
+		XamlView->SetFlags(Flags);
+		AppliedFlags = Flags;
+	}
+}
+
+void UNoesisInstance::FinishUpdate()
+{
+	LastUpdateTime = FPlatformTime::Seconds();
+	LastUpdateFrame = GFrameCounter;
+	LastViewChangeCount = ViewChanges->ChangeCount.GetValue();
+	UpdatePending = false;
+	LowPriorityUpdateDeferred = false;
+}
+
+void UNoesisInstance::InvalidateViewState()
+{
+	AppliedWidth = -1.0f;
+	AppliedHeight = -1.0f;
+	AppliedTessellationQuality = MAX_uint8;
+	AppliedFlags = MAX_uint32;
+}
+
+bool UNoesisInstance::ShouldUpdate(float InWidth, float InHeight)
+{
+	if (!XamlView)
+		return false;
+
+	bool Resized = InWidth != AppliedWidth || InHeight != AppliedHeight;
+	double Elapsed = FPlatformTime::Seconds() - LastUpdateTime;
+	switch (UpdateMode)
+	{
+	case ENoesisUpdateMode::FixedRate:
+		return Resized || UpdateRate <= 0.0f || Elapsed >= 1.0 / UpdateRate;
+	case ENoesisUpdateMode::WhenVisible:
+		// Widgets tick before they paint, so this is what the previous frame drew
+		return Resized || (LastPaintVisible && LastPaintFrame + 1 >= GFrameCounter);
+	case ENoesisUpdateMode::OnInputOrChange:
+		return Resized || UpdatePending || LastViewChangeCount != ViewChanges->ChangeCount.GetValue() || (UpdateRate > 0.0f && Elapsed >= 1.0 / UpdateRate);
+	default:
+		return true;
 	}
 }
 
+void UNoesisInstance::UpdateRetainedRenderTarget()
+{
+	int32 SizeX = FMath::Max(1, FMath::RoundToInt(Width));
+	int32 SizeY = FMath::Max(1, FMath::RoundToInt(Height));
+	if (!RetainedRenderTarget)
+	{
+		RetainedRenderTarget = NewObject<UTextureRenderTarget2D>(this);
+		RetainedRenderTarget->ClearColor = FLinearColor::Transparent;
+		RetainedRenderTarget->InitCustomFormat(SizeX, SizeY, PF_B8G8R8A8, true);
+		RetainedBrush.SetResourceObject(RetainedRenderTarget);
+	}
+	else if (RetainedRenderTarget->SizeX != SizeX || RetainedRenderTarget->SizeY != SizeY)
+	{
+		RetainedRenderTarget->ResizeTarget(SizeX, SizeY);
+	}
+	RetainedBrush.ImageSize = FVector2D(SizeX, SizeY);
+}
+
 FVector2D UNoesisInstance::GetSize() const
 {
 	if (Xaml)
@@ -544,6 +828,9 @@ bool UNoesisInstance::HitTest(FVector2D Position)
 
 void UNoesisInstance::TermInstance()
 {
+	++AsyncInitSerial;
+	ReleaseDependencies();
+
 	if (XamlView)
 	{
 		Noesis::Ptr<Noesis::IRenderer> Renderer(XamlView->GetRenderer());
@@ -628,16 +915,8 @@ void UNoesisInstance::DrawThumbnail(FIntRect ViewportRect, const FTexture2DRHIRe
 				Renderer->UpdateRenderTree();
 				Renderer->RenderOffscreen();
 
-				uint32 SizeX = BackBuffer->GetSizeX();
-				uint32 SizeY = BackBuffer->GetSizeY();
-				uint8 Format = (uint8)PF_DepthStencil;
-				uint32 NumMips = BackBuffer->GetNumMips();
-				uint32 NumSamples = BackBuffer->GetNumSamples();
-				uint32 TargetableTextureFlags = (uint32)TexCreate_DepthStencilTargetable;
-				FRHIResourceCreateInfo CreateInfo;
-				CreateInfo.ClearValueBinding = FClearValueBinding(0.f, 0);
 				FTexture2DRHIRef ColorTarget = BackBuffer;
-				FTexture2DRHIRef DepthStencilTarget = RHICreateTexture2D(SizeX, SizeY, Format, NumMips, NumSamples, TargetableTextureFlags, CreateInfo);
+				FTexture2DRHIRef DepthStencilTarget = FNoesisRenderDevice::Get()->RenderTargetPool.FindFreeDepthStencil(BackBuffer->GetSizeX(), BackBuffer->GetSizeY(), BackBuffer->GetNumSamples());
 				FRHIRenderPassInfo RPInfo(ColorTarget, ERenderTargetActions::Load_Store, DepthStencilTarget,
 					MakeDepthStencilTargetActions(ERenderTargetActions::DontLoad_DontStore, ERenderTargetActions::Clear_DontStore), FExclusiveDepthStencil::DepthNop_StencilWrite);
 
@@ -662,14 +941,64 @@ void UNoesisInstance::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 
 	FVector2D AbsolutePosition = MyGeometry.GetAbsolutePosition();
 	FVector2D AbsoluteSize = MyGeometry.GetAbsoluteSize();
-	Update(AbsolutePosition.X, AbsolutePosition.Y, AbsoluteSize.X, AbsoluteSize.Y);
+	if (!ShouldUpdate(AbsoluteSize.X, AbsoluteSize.Y))
+	{
+		INC_DWORD_STAT(STAT_NoesisInstance_UpdatesSkipped);
+		Left = AbsolutePosition.X;
+		Top = AbsolutePosition.Y;
+	}
+	else if (LowPriorityUpdate && !LowPriorityUpdateBudget.TryAcquire(LowPriorityUpdateDeferred, LowPriorityUpdateSeconds))
+	{
+		LowPriorityUpdateDeferred = true;
+		INC_DWORD_STAT(STAT_NoesisInstance_UpdatesDeferred);
+		Left = AbsolutePosition.X;
+		Top = AbsolutePosition.Y;
+	}
+	else
+	{
+		double UpdateStart = FPlatformTime::Seconds();
+		Update(AbsolutePosition.X, AbsolutePosition.Y, AbsoluteSize.X, AbsoluteSize.Y);
+		if (LowPriorityUpdate)
+		{
+			LowPriorityUpdateSeconds = FPlatformTime::Seconds() - UpdateStart;
+			LowPriorityUpdateBudget.Spend(LowPriorityUpdateSeconds);
+		}
+	}
+
+	if (RetainedMode && XamlView)
+	{
+		UpdateRetainedRenderTarget();
+	}
 }
 
 int32 UNoesisInstance::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
 	int32 MaxLayer = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
 
-	if (XamlView)
+	// The tint carries the opacity of the parents too, a view faded out or clipped away isn't seen
+	LastPaintFrame = GFrameCounter;
+	LastPaintVisible = InWidgetStyle.GetColorAndOpacityTint().A > 0.0f &&
+		FSlateRect::DoRectanglesIntersect(MyCullingRect, AllottedGeometry.GetLayoutBoundingRect());
+
+	if (XamlView && RetainedMode && RetainedRenderTarget)
+	{
+		FTextureRenderTargetResource* RenderTargetResource = RetainedRenderTarget->GameThread_GetRenderTargetResource();
+
+		ENQUEUE_RENDER_COMMAND(FNoesisInstance_DrawRetained)
+		(
+			[NoesisSlateElement = NoesisSlateElement, RenderTargetResource](FRHICommandListImmediate& RHICmdList)
+			{
+				NoesisSlateElement->DrawRetainedRenderThread(RHICmdList, RenderTargetResource);
+			}
+		);
+
+		// Noesis output uses premultiplied alpha
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), &RetainedBrush,
+			ESlateDrawEffect::PreMultipliedAlpha, InWidgetStyle.GetColorAndOpacityTint());
+
+		MaxLayer = FMath::Max(MaxLayer, LayerId);
+	}
+	else if (XamlView)
 	{
 		Noesis::Ptr<Noesis::IRenderer> Renderer(XamlView->GetRenderer());
 
@@ -706,6 +1035,7 @@ FReply UNoesisInstance::NativeOnKeyChar(const FGeometry& MyGeometry, const FChar
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnKeyChar);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		TCHAR Character = CharacterEvent.GetCharacter();
 
 		XamlView->Char(CharCast<char>(Character));
@@ -1162,6 +1492,7 @@ FReply UNoesisInstance::NativeOnKeyDown(const FGeometry& MyGeometry, const FKeyE
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnKeyDown);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FKey Key = KeyEvent.GetKey();
 
 		XamlView->KeyDown(KeyToNoesisKey(Key));
@@ -1175,6 +1506,7 @@ FReply UNoesisInstance::NativeOnKeyUp(const FGeometry& MyGeometry, const FKeyEve
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnKeyUp);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FKey Key = KeyEvent.GetKey();
 
 		XamlView->KeyUp(KeyToNoesisKey(Key));
@@ -1188,6 +1520,7 @@ FReply UNoesisInstance::NativeOnMouseButtonDown(const FGeometry& MyGeometry, con
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnMouseButtonDown);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 		FKey Button = MouseEvent.GetEffectingButton();
 
@@ -1228,6 +1561,7 @@ FReply UNoesisInstance::NativeOnMouseButtonUp(const FGeometry& MyGeometry, const
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnMouseButtonUp);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 		FKey Button = MouseEvent.GetEffectingButton();
 
@@ -1268,6 +1602,7 @@ FReply UNoesisInstance::NativeOnMouseMove(const FGeometry& MyGeometry, const FPo
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnMouseMove);
 	if (XamlView && !MouseEvent.GetCursorDelta().IsZero()) // Ignore synthetic events that are messing with the tooltip code.
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 
 		XamlView->MouseMove(FPlatformMath::RoundToInt(Position.X), FPlatformMath::RoundToInt(Position.Y));
@@ -1286,6 +1621,7 @@ FReply UNoesisInstance::NativeOnMouseWheel(const FGeometry& MyGeometry, const FP
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnMouseWheel);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 		float WheelDelta = MouseEvent.GetWheelDelta();
 
@@ -1305,6 +1641,7 @@ FReply UNoesisInstance::NativeOnTouchStarted(const FGeometry& MyGeometry, const
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnTouchStarted);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(TouchEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 		uint32 PointerIndex = TouchEvent.GetPointerIndex();
 
@@ -1324,6 +1661,7 @@ FReply UNoesisInstance::NativeOnTouchMoved(const FGeometry& MyGeometry, const FP
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnTouchMoved);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(TouchEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 		uint32 PointerIndex = TouchEvent.GetPointerIndex();
 
@@ -1343,6 +1681,7 @@ FReply UNoesisInstance::NativeOnTouchEnded(const FGeometry& MyGeometry, const FP
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnTouchEnded);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(TouchEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 		uint32 PointerIndex = TouchEvent.GetPointerIndex();
 
@@ -1367,6 +1706,7 @@ FReply UNoesisInstance::NativeOnMouseButtonDoubleClick(const FGeometry& MyGeomet
 	SCOPE_CYCLE_COUNTER(STAT_NoesisInstance_OnMouseButtonDoubleClick);
 	if (XamlView)
 	{
+		UpdatePending = true;
 		FVector2D Position = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()) * MyGeometry.Scale;
 		FKey Button = MouseEvent.GetEffectingButton();
 
@@ -1411,5 +1751,13 @@ void UNoesisInstance::InitializeNativeClassData()
 {
 	Super::InitializeNativeClassData();
 
-	InitInstance();
+	UNoesisBlueprintGeneratedClass* NoesisBlueprintGeneratedClass = Cast<UNoesisBlueprintGeneratedClass>(GetClass());
+	if (NoesisBlueprintGeneratedClass && NoesisBlueprintGeneratedClass->AsyncInit && !IsDesignTime())
+	{
+		InitInstanceAsync(FNoesisInstanceInitialized());
+	}
+	else
+	{
+		InitInstance();
+	}
 }
@@ -6,6 +6,8 @@
 #include "NoesisResourceProvider.h"
 
 // Core includes
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
 
 // Engine includes
@@ -18,10 +20,23 @@
 #include "NoesisXaml.h"
 #include "NoesisSupport.h"
 
+static FString GetProviderObjectPath(const FString& AssetPath)
+{
+	int32 DotIndex = INDEX_NONE;
+	return AssetPath.FindChar(TEXT('.'), DotIndex) ? AssetPath : AssetPath + TEXT(".") + FPackageName::GetShortName(AssetPath);
+}
+
+template<class T>
+static T* LoadProviderObject(const FString& AssetPath)
+{
+	check(IsInGameThread());
+	return LoadObject<T>(nullptr, *AssetPath);
+}
+
 UNoesisXaml* FNoesisXamlProvider::GetXaml(FString XamlProviderPath) const
 {
 	FString XamlPath = NsProviderPathToAssetPath(XamlProviderPath);
-	return LoadObject<UNoesisXaml>(nullptr, *XamlPath);
+	return LoadProviderObject<UNoesisXaml>(XamlPath);
 }
 
 Noesis::Ptr<Noesis::Stream> FNoesisXamlProvider::LoadXaml(const char* Path)
@@ -29,7 +44,8 @@ Noesis::Ptr<Noesis::Stream> FNoesisXamlProvider::LoadXaml(const char* Path)
 	UNoesisXaml* Xaml = GetXaml(Path);
 	if (Xaml)
 	{
-		return Noesis::Ptr<Noesis::Stream>(*new Noesis::MemoryStream(Xaml->XamlText.GetData(), (uint32)Xaml->XamlText.Num()));
+		const TArray<uint8>& Text = Xaml->GetProviderText(Path);
+		return Noesis::Ptr<Noesis::Stream>(*new Noesis::MemoryStream(Text.GetData(), (uint32)Text.Num()));
 	}
 
 	return Noesis::Ptr<Noesis::Stream>();
@@ -38,11 +54,48 @@ Noesis::Ptr<Noesis::Stream> FNoesisXamlProvider::LoadXaml(const char* Path)
 UTexture2D* FNoesisTextureProvider::GetTexture(FString TextureProviderPath) const
 {
 	FString TexturePath = NsProviderPathToAssetPath(TextureProviderPath);
-	return LoadObject<UTexture2D>(nullptr, *TexturePath);
+	return LoadProviderObject<UTexture2D>(TexturePath);
+}
+
+void FNoesisTextureProvider::RegisterTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size)
+{
+	FScopeLock Lock(&TextureSizesLock);
+	FTextureSize& Entry = TextureSizes.FindOrAdd(TexturePath);
+	Entry.Size = Size;
+	++Entry.RefCount;
+}
+
+void FNoesisTextureProvider::UnregisterTextureSize(const FSoftObjectPath& TexturePath)
+{
+	FScopeLock Lock(&TextureSizesLock);
+	FTextureSize* Entry = TextureSizes.Find(TexturePath);
+	if (Entry && --Entry->RefCount <= 0)
+	{
+		TextureSizes.Remove(TexturePath);
+	}
+}
+
+void FNoesisTextureProvider::UpdateTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size)
+{
+	FScopeLock Lock(&TextureSizesLock);
+	FTextureSize* Entry = TextureSizes.Find(TexturePath);
+	if (Entry)
+	{
+		Entry->Size = Size;
+	}
 }
 
 Noesis::TextureInfo FNoesisTextureProvider::GetTextureInfo(const char* Path)
 {
+	{
+		FScopeLock Lock(&TextureSizesLock);
+		const FTextureSize* Entry = TextureSizes.Find(FSoftObjectPath(GetProviderObjectPath(NsProviderPathToAssetPath(Path))));
+		if (Entry)
+		{
+			return Noesis::TextureInfo{ (uint32)Entry->Size.X, (uint32)Entry->Size.Y };
+		}
+	}
+
 	UTexture* Texture = GetTexture(Path);
 	if (Texture)
 	{
@@ -102,36 +155,80 @@ void FNoesisFontProvider::ScanFolder(const char* InFolder)
 {
 }
 
-Noesis::Ptr<Noesis::Stream> FNoesisFontProvider::OpenFont(const char* InFolder, const char* InFilename) const
+class FNoesisFontArrayStream : public Noesis::MemoryStream
 {
-	const UFontFace* FontFace = LoadObject<UFontFace>(nullptr, *NsStringToFString(InFilename));
-	if (FontFace)
+public:
+	FNoesisFontArrayStream(TArray<uint8>&& InFileData)
+		: Noesis::MemoryStream(InFileData.GetData(), (uint32)InFileData.Num()),
+		FileData(MoveTemp(InFileData))
 	{
-		class FontArrayMemoryStream : public Noesis::MemoryStream
-		{
-		public:
-			FontArrayMemoryStream(TArray<uint8>&& InFileData)
-				: Noesis::MemoryStream(InFileData.GetData(), (uint32)InFileData.Num()),
-				FileData(MoveTemp(InFileData))
-			{
-			}
-
-		private:
-			TArray<uint8> FileData;
-		};
-		if (FontFace->GetLoadingPolicy() == EFontLoadingPolicy::Inline)
-		{
-			const FFontFaceDataRef FontFaceDataRef = FontFace->FontFaceData;
-			const FFontFaceData& FontFaceData = FontFaceDataRef.Get();
-			const TArray<uint8>& FontFaceDataArray = FontFaceData.GetData();
-			return Noesis::Ptr<Noesis::Stream>(*new FontArrayMemoryStream(CopyTemp(FontFaceDataArray)));
-		}
-		else
+	}
+
+private:
+	TArray<uint8> FileData;
+};
+
+// Reads inline font data in place, keeping a reference so the data outlives the stream even if the font face is reloaded
+class FNoesisFontFaceDataStream : public Noesis::MemoryStream
+{
+public:
+	FNoesisFontFaceDataStream(const FFontFaceDataConstRef& InFontFaceData)
+		: Noesis::MemoryStream(InFontFaceData->GetData().GetData(), (uint32)InFontFaceData->GetData().Num()),
+		FontFaceData(InFontFaceData)
+	{
+	}
+
+private:
+	FFontFaceDataConstRef FontFaceData;
+};
+
+// Reads font files through a memory mapping, so only the pages of the glyphs actually used become resident
+class FNoesisMappedFontStream : public Noesis::MemoryStream
+{
+public:
+	FNoesisMappedFontStream(TUniquePtr<IMappedFileHandle>&& InMappedFile, TUniquePtr<IMappedFileRegion>&& InMappedRegion)
+		: Noesis::MemoryStream(InMappedRegion->GetMappedPtr(), (uint32)InMappedRegion->GetMappedSize()),
+		MappedFile(MoveTemp(InMappedFile)), MappedRegion(MoveTemp(InMappedRegion))
+	{
+	}
+
+private:
+	// Members are destroyed in reverse order, so the region is released before the file it was mapped from
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+};
+
+Noesis::Ptr<Noesis::Stream> NoesisOpenFontFace(const UFontFace* FontFace)
+{
+	if (FontFace->GetLoadingPolicy() == EFontLoadingPolicy::Inline)
+	{
+		FFontFaceDataConstRef FontFaceData = FontFace->FontFaceData;
+		return Noesis::Ptr<Noesis::Stream>(*new FNoesisFontFaceDataStream(FontFaceData));
+	}
+
+	const FString& FontFilename = FontFace->GetFontFilename();
+	TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FontFilename));
+	if (MappedFile && MappedFile->GetFileSize() > 0)
+	{
+		TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion());
+		if (MappedRegion)
 		{
-			TArray<uint8> FileData;
-			FFileHelper::LoadFileToArray(FileData, *FontFace->GetFontFilename());
-			return Noesis::Ptr<Noesis::Stream>(*new FontArrayMemoryStream(MoveTemp(FileData)));
+			return Noesis::Ptr<Noesis::Stream>(*new FNoesisMappedFontStream(MoveTemp(MappedFile), MoveTemp(MappedRegion)));
 		}
 	}
+
+	// Not every platform supports mapping files, those read the whole file instead
+	TArray<uint8> FileData;
+	FFileHelper::LoadFileToArray(FileData, *FontFilename);
+	return Noesis::Ptr<Noesis::Stream>(*new FNoesisFontArrayStream(MoveTemp(FileData)));
+}
+
+Noesis::Ptr<Noesis::Stream> FNoesisFontProvider::OpenFont(const char* InFolder, const char* InFilename) const
+{
+	const UFontFace* FontFace = LoadProviderObject<UFontFace>(NsStringToFString(InFilename));
+	if (FontFace)
+	{
+		return NoesisOpenFontFace(FontFace);
+	}
 	return Noesis::Ptr<Noesis::Stream>();
 }
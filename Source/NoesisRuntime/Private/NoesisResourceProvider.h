@@ -8,6 +8,9 @@
 // Core includes
 #include "CoreMinimal.h"
 
+// CoreUObject includes
+#include "UObject/SoftObjectPath.h"
+
 // Noesis includes
 #include "NoesisSDK.h"
 
@@ -24,14 +27,36 @@ public:
 
 class FNoesisTextureProvider : public Noesis::TextureProvider
 {
+public:
+	void RegisterTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size);
+	void UnregisterTextureSize(const FSoftObjectPath& TexturePath);
+	void UpdateTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size);
+
+private:
 	class UTexture2D* GetTexture(FString TextureProviderPath) const;
 
 	// TextureProvider interface
 	virtual Noesis::TextureInfo GetTextureInfo(const char* Path) override;
 	virtual Noesis::Ptr<Noesis::Texture> LoadTexture(const char* Path, Noesis::RenderDevice* RenderDevice) override;
 	// End of TextureProvider interface
+
+	// Sizes recorded by the XAMLs referencing the textures, so layout doesn't need to load the textures.
+	// Counted per referencing XAML, the entry goes away with the last one
+	struct FTextureSize
+	{
+		FTextureSize() : Size(0, 0), RefCount(0) {}
+
+		FIntPoint Size;
+		int32 RefCount;
+	};
+	FCriticalSection TextureSizesLock;
+	TMap<FSoftObjectPath, FTextureSize> TextureSizes;
 };
 
+// Stream over the data of a font face. Inline data is read in place and font files are memory mapped when the
+// platform supports it, only other platforms read the whole file
+Noesis::Ptr<Noesis::Stream> NoesisOpenFontFace(const class UFontFace* FontFace);
+
 class FNoesisFontProvider : public Noesis::CachedFontProvider
 {
 public:
@@ -35,6 +35,7 @@
 #include "NoesisTypeClass.h"
 #include "NoesisSettings.h"
 #include "NoesisSupport.h"
+#include "NoesisXaml.h"
 
 // Noesis includes
 #include "NoesisSDK.h"
@@ -454,6 +455,8 @@ public:
 		Noesis::GUI::SetTextureProvider(NoesisTextureProvider);
 		Noesis::GUI::SetFontProvider(NoesisFontProvider);
 
+		FNoesisRenderDevice::StartTextureStreaming();
+
 		LastSelectedTextBox.Reset();
 		LastSelectedPasswordBox.Reset();
 		Noesis::GUI::SetSoftwareKeyboardCallback(nullptr, &NoesisSoftwareKeyboardCallback);
@@ -462,7 +465,7 @@ public:
 
 		NoesisRuntimeModuleInterface = this;
 
-		PostGarbageCollectConditionalBeginDestroyDelegateHandle = FCoreUObjectDelegates::PostGarbageCollectConditionalBeginDestroy.AddStatic(NoesisGarbageCollected);
+		NoesisRegisterObjectDeleteListener();
 
 		PostEngineInitDelegateHandle = FCoreDelegates::OnPostEngineInit.AddStatic(OnPostEngineInit);
 
@@ -478,11 +481,16 @@ public:
 
 		FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitDelegateHandle);
 
-		FCoreUObjectDelegates::PostGarbageCollectConditionalBeginDestroy.Remove(PostGarbageCollectConditionalBeginDestroyDelegateHandle);
+		NoesisUnregisterObjectDeleteListener();
+
+		NoesisUnregisterTypes();
 
 		void NoesisDeleteMaps();
 		NoesisDeleteMaps();
 
+		UNoesisXaml::ClearTemplateCache();
+
+		FNoesisRenderDevice::StopTextureStreaming();
 		FNoesisRenderDevice::Destroy();
 
 		Noesis::GUI::SetXamlProvider(nullptr);
@@ -505,13 +513,27 @@ public:
 	{
 		NoesisFontProvider->RegisterFont(Font);
 	}
+
+	virtual void RegisterTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size) override
+	{
+		NoesisTextureProvider->RegisterTextureSize(TexturePath, Size);
+	}
+
+	virtual void UnregisterTextureSize(const FSoftObjectPath& TexturePath) override
+	{
+		NoesisTextureProvider->UnregisterTextureSize(TexturePath);
+	}
+
+	virtual void UpdateTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size) override
+	{
+		NoesisTextureProvider->UpdateTextureSize(TexturePath, Size);
+	}
 	// End of INoesisRuntimeModuleInterface interface
 
 	static INoesisRuntimeModuleInterface* NoesisRuntimeModuleInterface;
 	FNoesisXamlProvider* NoesisXamlProvider;
 	FNoesisTextureProvider* NoesisTextureProvider;
 	FNoesisFontProvider* NoesisFontProvider;
-	FDelegateHandle PostGarbageCollectConditionalBeginDestroyDelegateHandle;
 	FDelegateHandle PostEngineInitDelegateHandle;
 };
 
@@ -522,5 +544,10 @@ INoesisRuntimeModuleInterface& INoesisRuntimeModuleInterface::Get()
 	return *FNoesisRuntimeModule::NoesisRuntimeModuleInterface;
 }
 
+bool INoesisRuntimeModuleInterface::IsAvailable()
+{
+	return FNoesisRuntimeModule::NoesisRuntimeModuleInterface != nullptr;
+}
+
 IMPLEMENT_MODULE(FNoesisRuntimeModule, NoesisRuntime);
 DEFINE_LOG_CATEGORY(LogNoesis);
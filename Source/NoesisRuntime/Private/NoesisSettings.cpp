@@ -10,10 +10,17 @@ UNoesisSettings::UNoesisSettings(const FObjectInitializer& ObjectInitializer)
 {
 	OffscreenTextureSampleCount = ENoesisOffscreenSampleCount::One;
 	GlyphTextureSize = ENoesisGlyphCacheDimensions::x1024;
+	for (TCHAR Character = TEXT(' '); Character <= TEXT('~'); ++Character)
+	{
+		GlyphPrewarmBoundCharacters.AppendChar(Character);
+	}
+	RenderTargetPoolBudget = 64;
+	LowPriorityUpdateBudget = 2.0f;
 	ApplicationResources = FSoftObjectPath("/NoesisGUI/Theme/NoesisTheme_DarkBlue.NoesisTheme_DarkBlue");
 	DefaultFonts.Add(FSoftObjectPath("/NoesisGUI/Theme/Fonts/PT_Root_UI_Font.PT_Root_UI_Font"));
 	DefaultFontSize = 15.f;
 	DefaultFontWeight = ENoesisFontWeight::Normal;
 	DefaultFontStretch = ENoesisFontStretch::Normal;
 	DefaultFontStyle = ENoesisFontStyle::Normal;
+	XamlTemplateCacheBudget = 1024;
 }
@@ -6,12 +6,15 @@
 #include "NoesisTypeClass.h"
 
 // Core includes
+#include "Containers/Queue.h"
 #include "UObject/PropertyPortFlags.h"
 
 // CoreUObject includes
+#include "UObject/StructOnScope.h"
 #include "UObject/TextProperty.h"
 #include "UObject/UObjectIterator.h"
 #include "UObject/UObjectThreadContext.h"
+#include "UObject/UObjectArray.h"
 
 // Engine includes
 #include "Engine/Texture2D.h"
@@ -35,6 +38,9 @@
 #include "NoesisSDK.h"
 
 DECLARE_CYCLE_STAT(TEXT("NoesisNotifyPropertyChanged"), STAT_NoesisNotifyPropertyChanged, STATGROUP_Noesis);
+DECLARE_CYCLE_STAT(TEXT("NoesisFlushPropertyChanges"), STAT_NoesisFlushPropertyChanges, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisPropertyChangedIssued"), STAT_NoesisPropertyChangedIssued, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisPropertyChangedCoalesced"), STAT_NoesisPropertyChangedCoalesced, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertyAdd"), STAT_NoesisNotifyArrayPropertyAdd, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertyChanged"), STAT_NoesisNotifyArrayPropertyChanged, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertyAppend"), STAT_NoesisNotifyArrayPropertyAppend, STATGROUP_Noesis);
@@ -43,15 +49,97 @@ DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertyRemove"), STAT_NoesisNotifyArr
 DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertyClear"), STAT_NoesisNotifyArrayPropertyClear, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertyResize"), STAT_NoesisNotifyArrayPropertyResize, STATGROUP_Noesis);
 DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertySet"), STAT_NoesisNotifyArrayPropertySet, STATGROUP_Noesis);
-DECLARE_CYCLE_STAT(TEXT("NoesisGarbageCollected"), STAT_NoesisGarbageCollected, STATGROUP_Noesis);
+DECLARE_CYCLE_STAT(TEXT("NoesisNotifyArrayPropertyMove"), STAT_NoesisNotifyArrayPropertyMove, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisCollectionItemEvents"), STAT_NoesisCollectionItemEvents, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisCollectionMoves"), STAT_NoesisCollectionMoves, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisCollectionResets"), STAT_NoesisCollectionResets, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisArrayElementsBoxed"), STAT_NoesisArrayElementsBoxed, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisStructCopies"), STAT_NoesisStructCopies, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisStructViews"), STAT_NoesisStructViews, STATGROUP_Noesis);
+DECLARE_CYCLE_STAT(TEXT("NoesisPurgeDeletedObjects"), STAT_NoesisPurgeDeletedObjects, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisObjectWrappersRemoved"), STAT_NoesisObjectWrappersRemoved, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisComponentProxiesRemoved"), STAT_NoesisComponentProxiesRemoved, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisTypeClassesRemoved"), STAT_NoesisTypeClassesRemoved, STATGROUP_Noesis);
+DECLARE_CYCLE_STAT(TEXT("NoesisTypeClassFill"), STAT_NoesisTypeClassFill, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisTypePropertyListsReused"), STAT_NoesisTypePropertyListsReused, STATGROUP_Noesis);
 
 TMap<UObject*, Noesis::Ptr<Noesis::BaseComponent> > ObjectMap;
+TMap<Noesis::BaseComponent*, UObject*> ComponentMap;
+TMap<Noesis::BaseComponent*, UNoesisBaseComponent*> ComponentProxyMap;
+TMap<const UObjectBase*, Noesis::BaseComponent*> ProxyComponentMap;
 TMap<UStruct*, TPair<Noesis::TypeClass*, const char*> > ClassMap;
 TMap<UEnum*, TPair<Noesis::TypeEnum*, const char*> > EnumMap;
 TMap<uint32, class NoesisTypeEnum*> ConverterIdMap;
 TMap<void*, class NoesisArrayWrapperBase*> ArrayMap;
 TMap<FString, FString> RegisterNameMap;
 
+// The delete listener can run on the GC's async purge thread, so it only queues the keys of the maps above. The
+// entries are removed on the game thread after every GC, and before the maps are used, because the address of a
+// destroyed object can be reused by a new one
+TQueue<const UObjectBase*, EQueueMode::Mpsc> DeletedObjects;
+
+// One flag per GUObjectArray index, set for the objects used as keys so the listener skips all the others
+TArray<uint8> ObjectKeyFlags;
+
+static void FlagObjectKey(const UObjectBase* Object)
+{
+	int32 Index = GUObjectArray.ObjectToIndex(Object);
+	if (ObjectKeyFlags.IsValidIndex(Index))
+	{
+		ObjectKeyFlags[Index] = 1;
+	}
+}
+
+void NoesisPurgeDeletedObjects();
+
+static FNoesisViewChanges* CurrentViewChanges = nullptr;
+
+FNoesisViewChanges* NoesisSetCurrentViewChanges(FNoesisViewChanges* ViewChanges)
+{
+	check(IsInGameThread());
+	FNoesisViewChanges* Previous = CurrentViewChanges;
+	CurrentViewChanges = ViewChanges;
+	return Previous;
+}
+
+// Views whose bindings subscribed to the change events of a wrapper
+class FNoesisChangeListeners
+{
+public:
+	void AddCurrentView()
+	{
+		FNoesisViewChanges* Current = CurrentViewChanges;
+		if (Current == nullptr)
+			return;
+
+		for (auto& View : Views)
+		{
+			if (View.Pin().Get() == Current)
+				return;
+		}
+		Views.Add(Current->AsShared());
+	}
+
+	void Notify()
+	{
+		for (int32 Index = Views.Num(); Index-- > 0;)
+		{
+			TSharedPtr<FNoesisViewChanges, ESPMode::ThreadSafe> View = Views[Index].Pin();
+			if (View.IsValid())
+			{
+				View->ChangeCount.Increment();
+			}
+			else
+			{
+				Views.RemoveAtSwap(Index);
+			}
+		}
+	}
+
+private:
+	TArray<TWeakPtr<FNoesisViewChanges, ESPMode::ThreadSafe> > Views;
+};
+
 class NoesisObjectWrapper;
 class NoesisStructWrapper;
 class NoesisEnumWrapper;
@@ -555,6 +643,33 @@ void SetProperty<Noesis::TextureSource>(void* BasePointer, UProperty* Property,
 
 }
 
+// Whether Value, boxed by GetProperty, still holds the value of the property. Checked by unboxing into a
+// temporary, so cached boxes are validated without allocating new ones
+template<class T>
+bool IsPropertyValue(void* BasePointer, UProperty* Property, Noesis::BaseComponent* Value)
+{
+	uint8* PropertyValue = (uint8*)FMemory_Alloca(Property->ElementSize);
+	Property->InitializeValue(PropertyValue);
+	SetProperty<T>(PropertyValue, Property, Value);
+	bool Identical = Property->Identical(PropertyValue, Property->ContainerPtrToValuePtr<void>(BasePointer));
+	Property->DestroyValue(PropertyValue);
+	return Identical;
+}
+
+template<>
+bool IsPropertyValue<NoesisObjectWrapper>(void* BasePointer, UProperty* Property, Noesis::BaseComponent* Value)
+{
+	UObjectPropertyBase* ObjectProperty = (UObjectPropertyBase*)Property;
+	UObject** ObjectPtr = ComponentMap.Find(Value);
+	return ObjectPtr && *ObjectPtr == ObjectProperty->GetObjectPropertyValue(ObjectProperty->ContainerPtrToValuePtr<void>(BasePointer));
+}
+
+template<>
+bool IsPropertyValue<Noesis::TextureSource>(void* BasePointer, UProperty* Property, Noesis::BaseComponent* Value)
+{
+	return IsPropertyValue<NoesisObjectWrapper>(BasePointer, Property, Value);
+}
+
 template<class T>
 Noesis::Ptr<Noesis::BaseComponent> GetFunctionProperty(void* BasePointer, UFunction* Getter)
 {
@@ -672,7 +787,7 @@ class NoesisArrayWrapperBase : public Noesis::BaseComponent, public Noesis::ILis
 {
 public:
 	NoesisArrayWrapperBase(void* BasePointer, UArrayProperty* ArrayProperty, UProperty* ArrayInnerProperty)
-		: InnerProperty(ArrayInnerProperty), ArrayPointer(ArrayProperty->ContainerPtrToValuePtr<void>(BasePointer)), ArrayHelper(ArrayProperty, ArrayPointer), PreviousCount(INDEX_NONE)
+		: ElementViews(false), InnerProperty(ArrayInnerProperty), ArrayPointer(ArrayProperty->ContainerPtrToValuePtr<void>(BasePointer)), ArrayHelper(ArrayProperty, ArrayPointer), RemoveCount(0), PreviousCount(INDEX_NONE)
 	{
 		check(InnerProperty->GetOffset_ForDebug() == 0);
 		ArrayMap.Add(ArrayPointer, this);
@@ -680,6 +795,7 @@ public:
 
 	~NoesisArrayWrapperBase()
 	{
+		ResetCachedElements();
 		ArrayMap.Remove(ArrayPointer);
 	}
 
@@ -703,9 +819,20 @@ public:
 		return Noesis::BaseComponent::GetNumReferences();
 	}
 
+	bool IsValidElement(int32 Index) const
+	{
+		return Index >= 0 && Index < ArrayHelper.Num();
+	}
+
+	void* GetElementPtr(int32 Index) const
+	{
+		return ArrayHelper.GetRawPtr(Index);
+	}
+
 protected:
 	virtual Noesis::Ptr<Noesis::BaseComponent> NativeGet(uint32 Index) const = 0;
 	virtual void NativeSet(uint32 Index, Noesis::BaseComponent* Item) = 0;
+	virtual bool NativeIsCurrent(uint32 Index, Noesis::BaseComponent* Item) const = 0;
 	int32 NativeSize() const { return ArrayHelper.Num(); }
 	void NativeInsert(uint32 Index) { ArrayHelper.InsertValues(Index); }
 	void NativeClear() { ArrayHelper.EmptyValues(); }
@@ -720,7 +847,7 @@ public:
 
 	virtual Noesis::Ptr<Noesis::BaseComponent> GetComponent(uint32 Index) const override
 	{
-		return NativeGet(Index);
+		return GetElement(Index);
 	}
 
 	virtual void SetComponent(uint32 Index, Noesis::BaseComponent* Item) override
@@ -741,9 +868,17 @@ public:
 
 	virtual int IndexOfComponent(Noesis::BaseComponent* Item) const override
 	{
+		// Items handed out by GetComponent (SelectedItem and the like) are found by identity. Entries can be
+		// stale after the array changed, so they are verified against the cache before being trusted
+		const int32* IndexPtr = ElementIndices.Find(Item);
+		if (IndexPtr && ElementCache.IsValidIndex(*IndexPtr) && ElementCache[*IndexPtr].GetPtr() == Item && ElementCache.Num() == NativeSize())
+		{
+			return *IndexPtr;
+		}
+
 		for (uint32 Index = 0; Index != Count(); ++Index)
 		{
-			Noesis::Ptr<Noesis::BaseComponent> ItemAtIndex = NativeGet(Index);
+			Noesis::Ptr<Noesis::BaseComponent> ItemAtIndex = GetElement(Index);
 			if (ItemAtIndex && ItemAtIndex->Equals(Item))
 			{
 				return Index;
@@ -755,6 +890,7 @@ public:
 
 	virtual Noesis::NotifyCollectionChangedEventHandler& CollectionChanged() override
 	{
+		ChangeListeners.AddCurrentView();
 		return CollectionChangedHandler;
 	}
 
@@ -766,25 +902,43 @@ public:
 
 	void NotifyPostInsert(uint32 Index)
 	{
-		Noesis::Ptr<Noesis::BaseComponent> Item = NativeGet(Index);
+		InsertCachedElements(Index, 1);
+		RaiseAdd(Index);
+	}
+
+	// Noesis events carry a single item, so a range is raised as consecutive Add events, and only the containers
+	// for the new items get generated. Large ranges are raised as a Reset instead
+	void NotifyPostInsertRange(uint32 Index, uint32 Count)
+	{
+		InsertCachedElements(Index, Count);
+		if (Count > (uint32)MaxCollectionItemEvents)
+		{
+			RaiseReset();
+			return;
+		}
 
-		Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Add, -1, (int32)Index, nullptr, Item.GetPtr() };
-		CollectionChangedHandler(this, CollectionChangedArgs);
+		for (uint32 Offset = 0; Offset != Count; ++Offset)
+		{
+			RaiseAdd(Index + Offset);
+		}
 	}
 
 	void NotifyPreSet(int32 Index)
 	{
 		check(ItemToDelete == nullptr);
-		ItemToDelete = NativeGet(Index);
+		ItemToDelete = GetElement(Index);
+		DropCachedElement(Index);
 	}
 
 	void NotifyPostSet(int32 Index)
 	{
 		check(ItemToDelete != nullptr);
-		Noesis::Ptr<Noesis::BaseComponent> NewItem = NativeGet(Index);
+		DropCachedElement(Index);
+		Noesis::Ptr<Noesis::BaseComponent> NewItem = GetElement(Index);
 
 		Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Replace, (int32)Index, (int32)Index, ItemToDelete.GetPtr(), NewItem.GetPtr() };
 		CollectionChangedHandler(this, CollectionChangedArgs);
+		INC_DWORD_STAT(STAT_NoesisCollectionItemEvents);
 		ItemToDelete.Reset();
 	}
 
@@ -796,21 +950,194 @@ public:
 	void NotifyPreRemoveAt(int32 Index)
 	{
 		check(ItemToDelete == nullptr);
-		ItemToDelete = NativeGet(Index);
+		ItemToDelete = GetElement(Index);
+		DetachElementView(Index);
 	}
 
 	void NotifyPostRemoveAt(int32 Index)
 	{
 		check(ItemToDelete != nullptr);
+		RemoveCachedElements(Index, 1);
+
 		Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Remove, Index, -1, ItemToDelete.GetPtr(), nullptr };
 		CollectionChangedHandler(this, CollectionChangedArgs);
+		INC_DWORD_STAT(STAT_NoesisCollectionItemEvents);
 		ItemToDelete.Reset();
 	}
 
+	void NotifyPreRemoveRange(int32 Index, int32 Count)
+	{
+		check(ItemsToDelete.Num() == 0 && RemoveCount == 0);
+		RemoveCount = Count;
+		if (Count > MaxCollectionItemEvents)
+		{
+			for (int32 Offset = 0; Offset != Count; ++Offset)
+			{
+				DetachElementView(Index + Offset);
+			}
+			return;
+		}
+
+		ItemsToDelete.Reserve(Count);
+		for (int32 Offset = 0; Offset != Count; ++Offset)
+		{
+			ItemsToDelete.Add(GetElement(Index + Offset));
+			DetachElementView(Index + Offset);
+		}
+	}
+
+	void NotifyPostRemoveRange(int32 Index)
+	{
+		RemoveCachedElements(Index, RemoveCount);
+		if (RemoveCount > MaxCollectionItemEvents)
+		{
+			RemoveCount = 0;
+			RaiseReset();
+			return;
+		}
+		RemoveCount = 0;
+
+		// Removing from the back keeps the indices of the remaining items in the range valid
+		for (int32 Offset = ItemsToDelete.Num(); Offset-- > 0;)
+		{
+			Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Remove, Index + Offset, -1, ItemsToDelete[Offset].GetPtr(), nullptr };
+			CollectionChangedHandler(this, CollectionChangedArgs);
+			INC_DWORD_STAT(STAT_NoesisCollectionItemEvents);
+		}
+		ItemsToDelete.Reset();
+	}
+
+	void NotifyPostSwap(int32 IndexA, int32 IndexB)
+	{
+		int32 First = FMath::Min(IndexA, IndexB);
+		int32 Second = FMath::Max(IndexA, IndexB);
+		if (First != Second)
+		{
+			if (ElementCache.IsValidIndex(Second))
+			{
+				SwapCachedElements(First, Second);
+			}
+
+			// A swap is seen by the listeners as the second item moving in front of the first, then the first
+			// item (now shifted one position) moving to where the second one was
+			RaiseMove(Second, First);
+			if (Second != First + 1)
+			{
+				RaiseMove(First + 1, Second);
+			}
+		}
+	}
+
+	// NewToOldIndices[i] is the index the item now at i had before the array was reordered. Raises the Move
+	// events that take the previous order to the current one, so existing containers are kept. The items in the
+	// longest run that kept its relative order stay, only the others are moved. Reorders that would need more
+	// moves than MaxCollectionItemEvents are raised as a Reset instead
+	void NotifyPostReorder(const TArray<int32>& NewToOldIndices)
+	{
+		int32 Count = NativeSize();
+		check(NewToOldIndices.Num() == Count);
+
+		// The cached wrappers follow their items to the new positions
+		if (ElementCache.Num() == Count)
+		{
+			TArray<Noesis::Ptr<Noesis::BaseComponent> > ReorderedCache;
+			ReorderedCache.SetNum(Count);
+			for (int32 Index = 0; Index != Count; ++Index)
+			{
+				ReorderedCache[Index] = MoveTemp(ElementCache[NewToOldIndices[Index]]);
+			}
+			ElementCache = MoveTemp(ReorderedCache);
+			RebuildElementIndices();
+			UpdateElementViews(0);
+		}
+
+		// Longest increasing subsequence of the previous indices. RunTails[k] is the new index of the smallest
+		// last item of the runs of length k + 1 found so far, RunPrevious links each item to the one before it
+		TArray<int32> RunTails;
+		TArray<int32> RunPrevious;
+		RunPrevious.SetNumUninitialized(Count);
+		for (int32 Index = 0; Index != Count; ++Index)
+		{
+			int32 OldIndex = NewToOldIndices[Index];
+			int32 Low = 0;
+			int32 High = RunTails.Num();
+			while (Low < High)
+			{
+				int32 Middle = (Low + High) / 2;
+				if (NewToOldIndices[RunTails[Middle]] < OldIndex)
+				{
+					Low = Middle + 1;
+				}
+				else
+				{
+					High = Middle;
+				}
+			}
+
+			RunPrevious[Index] = Low > 0 ? RunTails[Low - 1] : INDEX_NONE;
+			if (Low == RunTails.Num())
+			{
+				RunTails.Add(Index);
+			}
+			else
+			{
+				RunTails[Low] = Index;
+			}
+		}
+
+		int32 MoveCount = Count - RunTails.Num();
+		if (MoveCount == 0)
+			return;
+
+		if (MoveCount > MaxCollectionItemEvents)
+		{
+			RaiseReset();
+			return;
+		}
+
+		TBitArray<> Stays(false, Count);
+		for (int32 Index = RunTails.Num() > 0 ? RunTails.Last() : INDEX_NONE; Index != INDEX_NONE; Index = RunPrevious[Index])
+		{
+			Stays[Index] = true;
+		}
+
+		// Order of the previous indices as seen by the listeners after each Move event. The items are moved in
+		// the order of their new index, so each one goes right after the item that precedes it now, which is
+		// either staying or already moved
+		TArray<int32> ListenerOrder;
+		ListenerOrder.SetNumUninitialized(Count);
+		for (int32 Index = 0; Index != Count; ++Index)
+		{
+			ListenerOrder[Index] = Index;
+		}
+
+		for (int32 Index = 0; Index != Count; ++Index)
+		{
+			if (Stays[Index])
+				continue;
+
+			int32 OldIndex = NewToOldIndices[Index];
+			int32 CurrentIndex = ListenerOrder.Find(OldIndex);
+			int32 TargetIndex = 0;
+			if (Index > 0)
+			{
+				int32 PrecedingIndex = ListenerOrder.Find(NewToOldIndices[Index - 1]);
+				TargetIndex = CurrentIndex < PrecedingIndex ? PrecedingIndex : PrecedingIndex + 1;
+			}
+
+			if (CurrentIndex != TargetIndex)
+			{
+				ListenerOrder.RemoveAt(CurrentIndex, 1, false);
+				ListenerOrder.Insert(OldIndex, TargetIndex);
+				RaiseMove(CurrentIndex, TargetIndex, Index);
+			}
+		}
+	}
+
 	void NotifyPostChanged()
 	{
-		Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Reset, -1, -1, nullptr, nullptr };
-		CollectionChangedHandler(this, CollectionChangedArgs);
+		ResetCachedElements();
+		RaiseReset();
 	}
 
 	void NotifyPreAppend()
@@ -822,11 +1149,7 @@ public:
 	void NotifyPostAppend()
 	{
 		check(PreviousCount != INDEX_NONE);
-		uint32 Count = NativeSize();
-		for (uint32 Index = PreviousCount; Index != Count; ++Index)
-		{
-			NotifyPostInsert(Index);
-		}
+		NotifyPostInsertRange(PreviousCount, NativeSize() - PreviousCount);
 		PreviousCount = INDEX_NONE;
 	}
 
@@ -837,13 +1160,213 @@ public:
 	}
 
 private:
+	// Element wrappers are cached, so listeners see the same item until a notification says the element
+	// changed. Struct elements are views that read the array in place, the other elements are checked against
+	// the array before being reused, as it can be written without notifications. A cache whose size doesn't
+	// match the array anymore was changed without notifications and is thrown away
+	Noesis::Ptr<Noesis::BaseComponent> GetElement(uint32 Index) const
+	{
+		int32 Size = NativeSize();
+		if (ElementCache.Num() != Size || (int32)Index >= Size)
+		{
+			ResetCachedElements();
+			ElementCache.SetNum(FMath::Max(Size, (int32)Index + 1));
+		}
+
+		Noesis::Ptr<Noesis::BaseComponent>& Element = ElementCache[Index];
+		if (Element && (int32)Index < Size && NativeIsCurrent(Index, Element.GetPtr()))
+		{
+			return Element;
+		}
+
+		DropCachedElement(Index);
+		Element = NativeGet(Index);
+		INC_DWORD_STAT(STAT_NoesisArrayElementsBoxed);
+		if (Element)
+		{
+			AddElementIndex(Element.GetPtr(), Index);
+		}
+		return Element;
+	}
+
+	// IndexOfComponent finds the first occurrence of an item
+	void AddElementIndex(Noesis::BaseComponent* Item, int32 Index) const
+	{
+		int32* IndexPtr = ElementIndices.Find(Item);
+		if (IndexPtr == nullptr || *IndexPtr > Index)
+		{
+			ElementIndices.Add(Item, Index);
+		}
+	}
+
+	void RebuildElementIndices() const
+	{
+		ElementIndices.Reset();
+		for (int32 Index = 0; Index != ElementCache.Num(); ++Index)
+		{
+			if (ElementCache[Index])
+			{
+				AddElementIndex(ElementCache[Index].GetPtr(), Index);
+			}
+		}
+	}
+
+	// Drops the index of the element only if it is its first occurrence. Later occurrences of the same item are
+	// then found by the search in IndexOfComponent
+	void DropCachedElement(int32 Index) const
+	{
+		if (!ElementCache.IsValidIndex(Index) || !ElementCache[Index])
+			return;
+
+		Noesis::BaseComponent* Item = ElementCache[Index].GetPtr();
+		const int32* IndexPtr = ElementIndices.Find(Item);
+		if (IndexPtr && *IndexPtr == Index)
+		{
+			ElementIndices.Remove(Item);
+		}
+		DetachElementView(Index);
+		ElementCache[Index].Reset();
+	}
+
+	void ResetCachedElements() const
+	{
+		for (int32 Index = 0; Index != ElementCache.Num(); ++Index)
+		{
+			DetachElementView(Index);
+		}
+		ElementCache.Reset();
+		ElementIndices.Reset();
+	}
+
+	// The elements from Index on moved by Delta positions. Only their entries are updated, so appending to the
+	// array doesn't touch the rest of the cache
+	void ShiftCachedElements(int32 Index, int32 Delta)
+	{
+		for (int32 NewIndex = Index; NewIndex < ElementCache.Num(); ++NewIndex)
+		{
+			if (ElementCache[NewIndex])
+			{
+				int32* IndexPtr = ElementIndices.Find(ElementCache[NewIndex].GetPtr());
+				if (IndexPtr && *IndexPtr == NewIndex - Delta)
+				{
+					*IndexPtr = NewIndex;
+				}
+			}
+		}
+		UpdateElementViews(Index);
+	}
+
+	void InsertCachedElements(uint32 Index, uint32 Count)
+	{
+		if ((int32)Index <= ElementCache.Num())
+		{
+			ElementCache.InsertDefaulted(Index, Count);
+			ShiftCachedElements(Index + Count, Count);
+		}
+	}
+
+	void RemoveCachedElements(int32 Index, int32 Count)
+	{
+		if (Index + Count <= ElementCache.Num())
+		{
+			for (int32 Offset = 0; Offset != Count; ++Offset)
+			{
+				DropCachedElement(Index + Offset);
+			}
+			ElementCache.RemoveAt(Index, Count);
+			ShiftCachedElements(Index, -Count);
+		}
+	}
+
+	void SwapCachedElements(int32 First, int32 Second)
+	{
+		// The item now at First was at Second, if that was its first occurrence it still is. The one now at
+		// Second could have another occurrence in between, so it is left to IndexOfComponent to find it
+		Noesis::BaseComponent* FirstItem = ElementCache[Second].GetPtr();
+		Noesis::BaseComponent* SecondItem = ElementCache[First].GetPtr();
+		int32* SecondIndexPtr = SecondItem ? ElementIndices.Find(SecondItem) : nullptr;
+		if (SecondIndexPtr && *SecondIndexPtr == First)
+		{
+			ElementIndices.Remove(SecondItem);
+		}
+		int32* FirstIndexPtr = FirstItem ? ElementIndices.Find(FirstItem) : nullptr;
+		if (FirstIndexPtr && *FirstIndexPtr == Second)
+		{
+			*FirstIndexPtr = First;
+		}
+
+		ElementCache.Swap(First, Second);
+		SetElementViewIndex(First);
+		SetElementViewIndex(Second);
+	}
+
+	void UpdateElementViews(int32 Index) const
+	{
+		if (ElementViews)
+		{
+			for (; Index < ElementCache.Num(); ++Index)
+			{
+				SetElementViewIndex(Index);
+			}
+		}
+	}
+
+	// Struct element views, defined once NoesisStructWrapper is
+	void DetachElementView(int32 Index) const;
+	void SetElementViewIndex(int32 Index) const;
+
+	void RaiseAdd(uint32 Index)
+	{
+		Noesis::Ptr<Noesis::BaseComponent> Item = GetElement(Index);
+
+		Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Add, -1, (int32)Index, nullptr, Item.GetPtr() };
+		CollectionChangedHandler(this, CollectionChangedArgs);
+		INC_DWORD_STAT(STAT_NoesisCollectionItemEvents);
+	}
+
+	void RaiseMove(int32 OldIndex, int32 NewIndex)
+	{
+		RaiseMove(OldIndex, NewIndex, NewIndex);
+	}
+
+	// ItemIndex is where the moved item is in the array, which can differ from where the listeners have it
+	// while the moves of a reorder are raised
+	void RaiseMove(int32 OldIndex, int32 NewIndex, int32 ItemIndex)
+	{
+		Noesis::Ptr<Noesis::BaseComponent> Item = GetElement(ItemIndex);
+
+		Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Move, OldIndex, NewIndex, Item.GetPtr(), Item.GetPtr() };
+		CollectionChangedHandler(this, CollectionChangedArgs);
+		INC_DWORD_STAT(STAT_NoesisCollectionMoves);
+	}
+
+	// The cache is kept, items keep their wrappers across the Reset
+	void RaiseReset()
+	{
+		Noesis::NotifyCollectionChangedEventArgs CollectionChangedArgs = { Noesis::NotifyCollectionChangedAction_Reset, -1, -1, nullptr, nullptr };
+		CollectionChangedHandler(this, CollectionChangedArgs);
+		INC_DWORD_STAT(STAT_NoesisCollectionResets);
+	}
+
+	// Above this many item events, a change is raised as a Reset. Regenerating every container is then cheaper
+	// than updating them one event at a time
+	static const int32 MaxCollectionItemEvents = 64;
+
 	Noesis::NotifyCollectionChangedEventHandler CollectionChangedHandler;
+	mutable TArray<Noesis::Ptr<Noesis::BaseComponent> > ElementCache;
+	mutable TMap<Noesis::BaseComponent*, int32> ElementIndices;
+
+protected:
+	bool ElementViews;
 
 public:
+	FNoesisChangeListeners ChangeListeners;
 	UProperty* InnerProperty;
 	void* ArrayPointer;
 	mutable FScriptArrayHelper ArrayHelper;
 	Noesis::Ptr<Noesis::BaseComponent> ItemToDelete;
+	TArray<Noesis::Ptr<Noesis::BaseComponent> > ItemsToDelete;
+	int32 RemoveCount;
 	int32 PreviousCount;
 };
 
@@ -855,6 +1378,7 @@ public:
 		: NoesisArrayWrapperBase(BasePointer, ArrayProperty, ArrayInnerProperty)
 	{
 		check(InnerProperty->GetOffset_ForDebug() == 0);
+		ElementViews = TIsSame<T, NoesisStructWrapper>::Value;
 	}
 
 	virtual Noesis::Ptr<Noesis::BaseComponent> NativeGet(uint32 Index) const override
@@ -868,6 +1392,11 @@ public:
 		ArrayHelper.ExpandForIndex(Index);
 		SetProperty<T>(ArrayHelper.GetRawPtr(Index), InnerProperty, Item);
 	}
+
+	virtual bool NativeIsCurrent(uint32 Index, Noesis::BaseComponent* Item) const override
+	{
+		return IsPropertyValue<T>(ArrayHelper.GetRawPtr(Index), InnerProperty, Item);
+	}
 };
 
 class NoesisFunctionWrapper : public Noesis::BaseCommand
@@ -1002,9 +1531,36 @@ class NoesisStructWrapper : public Noesis::BaseComponent
 public:
 
 	NoesisStructWrapper(Noesis::TypeClass* InTypeClass, UScriptStruct* InStruct) :
-		Noesis::BaseComponent(), TypeClass(InTypeClass), Struct(InStruct)
+		Noesis::BaseComponent(), TypeClass(InTypeClass), Struct(InStruct), ViewPtr(nullptr), Array(nullptr), ArrayIndex(INDEX_NONE)
+	{
+		AllocateStructData();
+	}
+
+	// Array element views read the element through the array, so they follow it when the array is reallocated
+	// or the element shifted. The array detaches them, with a copy of the element, when they leave its cache
+	NoesisStructWrapper(Noesis::TypeClass* InTypeClass, UScriptStruct* InStruct, const NoesisArrayWrapperBase* InArray, int32 InArrayIndex) :
+		Noesis::BaseComponent(), TypeClass(InTypeClass), Struct(InStruct), ViewPtr(nullptr), Array(InArray), ArrayIndex(InArrayIndex)
+	{
+		INC_DWORD_STAT(STAT_NoesisStructViews);
+	}
+
+	// Views read the struct in place, from the memory of a UObject or of a parent wrapper. The owner is only
+	// weakly referenced, if it goes away the view falls back to a default struct. Views with a parent are kept
+	// at their offset in it, so they follow the parent when it falls back too
+	NoesisStructWrapper(Noesis::TypeClass* InTypeClass, UScriptStruct* InStruct, void* InViewPtr, UObject* InOwner, const NoesisStructWrapper* InParent) :
+		Noesis::BaseComponent(), TypeClass(InTypeClass), Struct(InStruct), ViewPtr(InViewPtr), Owner(InOwner), Parent(const_cast<NoesisStructWrapper*>(InParent)),
+		ViewOffset(InParent ? (uint8*)InViewPtr - (uint8*)InParent->GetStructPtr() : 0), Array(nullptr), ArrayIndex(INDEX_NONE)
+	{
+		check(InOwner != nullptr || InParent != nullptr);
+		INC_DWORD_STAT(STAT_NoesisStructViews);
+	}
+
+	~NoesisStructWrapper()
 	{
-		StructData.Empty(InStruct->GetStructureSize());
+		if (StructData.Num() != 0)
+		{
+			Struct->DestroyStruct(StructData.GetData());
+		}
 	}
 
 	virtual const Noesis::TypeClass* GetClassType() const override
@@ -1056,15 +1612,109 @@ public:
 
 	void* GetStructPtr() const
 	{
-		return (void*)StructData.GetData();
-	}
-
-public:
+		if (Array)
+		{
+			if (Array->IsValidElement(ArrayIndex))
+			{
+				return Array->GetElementPtr(ArrayIndex);
+			}
+			DetachFromArray();
+		}
+		if (ViewPtr)
+		{
+			if (Parent)
+			{
+				return (uint8*)Parent->GetStructPtr() + ViewOffset;
+			}
+			if (Owner.IsValid())
+			{
+				return ViewPtr;
+			}
+
+			ViewPtr = nullptr;
+			AllocateStructData();
+		}
+		return (void*)StructData.GetData();
+	}
+
+	void* GetBasePointer() const
+	{
+		return GetStructPtr();
+	}
+
+	bool IsView() const
+	{
+		return ViewPtr != nullptr;
+	}
+
+	void DetachFromArray() const
+	{
+		if (Array)
+		{
+			void* ElementPtr = Array->IsValidElement(ArrayIndex) ? Array->GetElementPtr(ArrayIndex) : nullptr;
+			Array = nullptr;
+			ArrayIndex = INDEX_NONE;
+			AllocateStructData();
+			if (ElementPtr)
+			{
+				Struct->CopyScriptStruct(StructData.GetData(), ElementPtr, 1);
+			}
+		}
+	}
+
+private:
+	void AllocateStructData() const
+	{
+		StructData.AddUninitialized(Struct->GetStructureSize());
+		Struct->InitializeStruct(StructData.GetData());
+	}
+
+public:
 	Noesis::TypeClass* TypeClass;
 	UScriptStruct* Struct;
-	TArray<uint8_t> StructData;
+	mutable TArray<uint8_t> StructData;
+	mutable void* ViewPtr;
+	TWeakObjectPtr<UObject> Owner;
+	Noesis::Ptr<NoesisStructWrapper> Parent;
+	PTRINT ViewOffset;
+	mutable const NoesisArrayWrapperBase* Array;
+	mutable int32 ArrayIndex;
 };
 
+void NoesisArrayWrapperBase::DetachElementView(int32 Index) const
+{
+	if (ElementViews && ElementCache.IsValidIndex(Index) && ElementCache[Index])
+	{
+		((NoesisStructWrapper*)ElementCache[Index].GetPtr())->DetachFromArray();
+	}
+}
+
+void NoesisArrayWrapperBase::SetElementViewIndex(int32 Index) const
+{
+	if (ElementViews && ElementCache[Index])
+	{
+		NoesisStructWrapper* View = (NoesisStructWrapper*)ElementCache[Index].GetPtr();
+		if (View->Array == this)
+		{
+			View->ArrayIndex = Index;
+		}
+	}
+}
+
+template<>
+Noesis::Ptr<Noesis::BaseComponent> NoesisArrayWrapper<NoesisStructWrapper>::NativeGet(uint32 Index) const
+{
+	ArrayHelper.ExpandForIndex(Index);
+	UScriptStruct* Struct = ((UStructProperty*)InnerProperty)->Struct;
+	return *new NoesisStructWrapper(NoesisCreateTypeClassForUStruct(Struct), Struct, this, Index);
+}
+
+template<>
+bool NoesisArrayWrapper<NoesisStructWrapper>::NativeIsCurrent(uint32 Index, Noesis::BaseComponent* Item) const
+{
+	return ((NoesisStructWrapper*)Item)->Array == this;
+}
+
 class NoesisObjectWrapper : public Noesis::BaseComponent, public Noesis::INotifyPropertyChanged
 {
 public:
@@ -1081,6 +1731,7 @@ public:
 
 	virtual Noesis::PropertyChangedEventHandler& PropertyChanged() override
 	{
+		ChangeListeners.AddCurrentView();
 		return PropertyChangedHandler;
 	}
 
@@ -1143,9 +1794,31 @@ public:
 	template<class T>
 	bool SetProperty(const TypePropertyData& Data, Noesis::BaseComponent* Value)
 	{
-		Noesis::Ptr<Noesis::BaseComponent> OldValue = ::GetProperty<T>(Object, Data.Property);
-		::SetProperty<T>(Object, Data.Property, Value);
-		Noesis::Ptr<Noesis::BaseComponent> NewValue = ::GetProperty<T>(Object, Data.Property);
+		// Plain old data is compared in place, everything else through boxed copies
+		UProperty* Property = Data.Property;
+		if ((Property->PropertyFlags & CPF_IsPlainOldData) && Property->ElementSize <= MaxRawCompareSize)
+		{
+			uint8 OldValue[MaxRawCompareSize];
+			const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
+			FMemory::Memcpy(OldValue, ValuePtr, Property->ElementSize);
+			::SetProperty<T>(Object, Property, Value);
+			return FMemory::Memcmp(OldValue, ValuePtr, Property->ElementSize) != 0;
+		}
+
+		// Struct views read the object memory, so the old value has to be copied before it's overwritten
+		if (Property->IsA<UStructProperty>())
+		{
+			UScriptStruct* Struct = ((UStructProperty*)Property)->Struct;
+			const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
+			FStructOnScope OldValue(Struct);
+			Struct->CopyScriptStruct(OldValue.GetStructMemory(), ValuePtr);
+			::SetProperty<T>(Object, Property, Value);
+			return !Struct->CompareScriptStruct(OldValue.GetStructMemory(), ValuePtr, PPF_None);
+		}
+
+		Noesis::Ptr<Noesis::BaseComponent> OldValue = ::GetProperty<T>(Object, Property);
+		::SetProperty<T>(Object, Property, Value);
+		Noesis::Ptr<Noesis::BaseComponent> NewValue = ::GetProperty<T>(Object, Property);
 		return (NewValue && !NewValue->Equals(OldValue.GetPtr()));
 	}
 	template<class T>
@@ -1236,14 +1909,63 @@ public:
 		PropertyChangedHandler(this, ChangedEventArgs);
 	}
 
+	void* GetBasePointer() const
+	{
+		return Object;
+	}
+
+	static const int32 MaxRawCompareSize = 64;
+
 public:
 	Noesis::PropertyChangedEventHandler PropertyChangedHandler;
+	FNoesisChangeListeners ChangeListeners;
 	mutable TMap<UFunction*, Noesis::Ptr<Noesis::BaseComponent> > FunctionToCommand;
 	mutable TMap<UArrayProperty*, Noesis::Ptr<Noesis::BaseComponent> > ArrayToList;
 	Noesis::TypeClass* TypeClass;
 	UObject* Object;
 };
 
+Noesis::Ptr<Noesis::BaseComponent> NoesisCreateStructView(UScriptStruct* Struct, void* ViewPtr, UObject* Owner, const NoesisStructWrapper* Parent)
+{
+	Noesis::TypeClass* TypeClass = NoesisCreateTypeClassForUStruct(Struct);
+	return *new NoesisStructWrapper(TypeClass, Struct, ViewPtr, Owner, Parent);
+}
+
+// Struct fields of objects and of other struct wrappers are handed out as views, as are the elements of object
+// arrays. Only the value read by SetProperty for change detection and the elements of arrays in structs are copied
+template<>
+Noesis::Ptr<Noesis::BaseComponent> NoesisObjectWrapper::GetProperty<NoesisStructWrapper>(const TypePropertyData& Data) const
+{
+	check(Data.Property->IsA<UStructProperty>());
+	UStructProperty* StructProperty = (UStructProperty*)Data.Property;
+	return NoesisCreateStructView(StructProperty->Struct, StructProperty->ContainerPtrToValuePtr<void>(Object), Object, nullptr);
+}
+
+template<>
+Noesis::Ptr<Noesis::BaseComponent> NoesisStructWrapper::GetProperty<NoesisStructWrapper>(const TypePropertyData& Data) const
+{
+	check(Data.Property->IsA<UStructProperty>());
+	UStructProperty* StructProperty = (UStructProperty*)Data.Property;
+	void* ViewPtr = StructProperty->ContainerPtrToValuePtr<void>(GetStructPtr());
+	if (IsView())
+	{
+		return NoesisCreateStructView(StructProperty->Struct, ViewPtr, Owner.Get(), Parent.GetPtr());
+	}
+	return NoesisCreateStructView(StructProperty->Struct, ViewPtr, nullptr, this);
+}
+
+// Properties whose value can be read and written straight from the UObject memory, without boxing
+enum class ETypePropertyDirectAccess : uint8
+{
+	None,
+	Int,
+	Float,
+	Bool,
+	Color,
+	Point,
+	Thickness
+};
+
 template<class T>
 class TypePropertyNoesisObjectWrapper : public Noesis::TypeProperty
 {
@@ -1272,16 +1994,109 @@ protected:
 	//@}
 
 private:
+	void* GetValuePtr(const void* Ptr) const;
+	bool SetDirect(void* ValuePtr, const void* Value) const;
+
 	GetterFn Getter;
 	SetterFn Setter;
 	const TypePropertyData Data;
+	ETypePropertyDirectAccess DirectAccess;
 };
 
 template<class T>
 TypePropertyNoesisObjectWrapper<T>::TypePropertyNoesisObjectWrapper(Noesis::Symbol Name, const Noesis::Type* Type, GetterFn InGetter, SetterFn InSetter, const TypePropertyData& InData) :
-	TypeProperty(Name, Type), Getter(InGetter), Setter(InSetter), Data(InData)
+	TypeProperty(Name, Type), Getter(InGetter), Setter(InSetter), Data(InData), DirectAccess(ETypePropertyDirectAccess::None)
 {
 	NS_ASSERT(Getter);
+
+	// Only plain field getters hold a UProperty in Data, function and array getters can't be accessed directly
+	if (Getter == &T::template GetProperty<int>)
+	{
+		DirectAccess = ETypePropertyDirectAccess::Int;
+	}
+	else if (Getter == &T::template GetProperty<float>)
+	{
+		DirectAccess = ETypePropertyDirectAccess::Float;
+	}
+	else if (Getter == &T::template GetProperty<bool>)
+	{
+		DirectAccess = ETypePropertyDirectAccess::Bool;
+	}
+	else if (Getter == &T::template GetProperty<Noesis::Color>)
+	{
+		DirectAccess = ETypePropertyDirectAccess::Color;
+	}
+	else if (Getter == &T::template GetProperty<Noesis::Point>)
+	{
+		static_assert(sizeof(FVector2D) == sizeof(Noesis::Point), "FVector2D must match the layout of Noesis::Point");
+		DirectAccess = ETypePropertyDirectAccess::Point;
+	}
+	else if (Getter == &T::template GetProperty<Noesis::Thickness>)
+	{
+		static_assert(sizeof(FNoesisThickness) == sizeof(Noesis::Thickness), "FNoesisThickness must match the layout of Noesis::Thickness");
+		DirectAccess = ETypePropertyDirectAccess::Thickness;
+	}
+}
+
+template<class T>
+void* TypePropertyNoesisObjectWrapper<T>::GetValuePtr(const void* Ptr) const
+{
+	return Data.Property->ContainerPtrToValuePtr<void>(static_cast<const T*>(Ptr)->GetBasePointer());
+}
+
+template<class T>
+bool TypePropertyNoesisObjectWrapper<T>::SetDirect(void* ValuePtr, const void* Value) const
+{
+	switch (DirectAccess)
+	{
+	case ETypePropertyDirectAccess::Int:
+	{
+		int32 NewValue = *(const int32*)Value;
+		bool Changed = *(int32*)ValuePtr != NewValue;
+		*(int32*)ValuePtr = NewValue;
+		return Changed;
+	}
+	case ETypePropertyDirectAccess::Float:
+	{
+		float NewValue = *(const float*)Value;
+		bool Changed = *(float*)ValuePtr != NewValue;
+		*(float*)ValuePtr = NewValue;
+		return Changed;
+	}
+	case ETypePropertyDirectAccess::Bool:
+	{
+		UBoolProperty* BoolProperty = (UBoolProperty*)Data.Property;
+		bool NewValue = *(const bool*)Value;
+		bool Changed = BoolProperty->GetPropertyValue(ValuePtr) != NewValue;
+		BoolProperty->SetPropertyValue(ValuePtr, NewValue);
+		return Changed;
+	}
+	case ETypePropertyDirectAccess::Color:
+	{
+		FColor NewValue = FColor(((const Noesis::Color*)Value)->GetPackedColorBGRA());
+#if !PLATFORM_LITTLE_ENDIAN
+		NewValue = FColor(NewValue.G, NewValue.R, NewValue.A, NewValue.B);
+#endif
+		bool Changed = *(FColor*)ValuePtr != NewValue;
+		*(FColor*)ValuePtr = NewValue;
+		return Changed;
+	}
+	case ETypePropertyDirectAccess::Point:
+	{
+		bool Changed = FMemory::Memcmp(ValuePtr, Value, sizeof(Noesis::Point)) != 0;
+		FMemory::Memcpy(ValuePtr, Value, sizeof(Noesis::Point));
+		return Changed;
+	}
+	case ETypePropertyDirectAccess::Thickness:
+	{
+		bool Changed = FMemory::Memcmp(ValuePtr, Value, sizeof(Noesis::Thickness)) != 0;
+		FMemory::Memcpy(ValuePtr, Value, sizeof(Noesis::Thickness));
+		return Changed;
+	}
+	default:
+		check(false);
+		return false;
+	}
 }
 
 template<class T>
@@ -1322,14 +2137,56 @@ void TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>::SetComponent(void* Pt
 template<class T>
 const void* TypePropertyNoesisObjectWrapper<T>::InternalGet(const void* Ptr) const
 {
-	check(false);
-	return nullptr;
+	switch (DirectAccess)
+	{
+	case ETypePropertyDirectAccess::Int:
+	case ETypePropertyDirectAccess::Float:
+	case ETypePropertyDirectAccess::Point:
+	case ETypePropertyDirectAccess::Thickness:
+		// Same layout in UObject memory and in Noesis
+		return GetValuePtr(Ptr);
+	default:
+		// Bool and Color are converted, so there's no pointer to return. They can only be read by copy
+		check(false);
+		return nullptr;
+	}
 }
 
 template<class T>
 void TypePropertyNoesisObjectWrapper<T>::InternalGet(const void* Ptr, void* Storage) const
 {
-	check(false);
+	void* ValuePtr = GetValuePtr(Ptr);
+	switch (DirectAccess)
+	{
+	case ETypePropertyDirectAccess::Int:
+		*(int32*)Storage = *(const int32*)ValuePtr;
+		break;
+	case ETypePropertyDirectAccess::Float:
+		*(float*)Storage = *(const float*)ValuePtr;
+		break;
+	case ETypePropertyDirectAccess::Bool:
+		*(bool*)Storage = ((UBoolProperty*)Data.Property)->GetPropertyValue(ValuePtr);
+		break;
+	case ETypePropertyDirectAccess::Color:
+	{
+		const FColor& Value = *(const FColor*)ValuePtr;
+#if PLATFORM_LITTLE_ENDIAN
+		*(Noesis::Color*)Storage = Noesis::Color::FromPackedBGRA(Value.DWColor());
+#else // PLATFORM_LITTLE_ENDIAN
+		*(Noesis::Color*)Storage = Noesis::Color(Value.R, Value.G, Value.B, Value.A);
+#endif
+		break;
+	}
+	case ETypePropertyDirectAccess::Point:
+		FMemory::Memcpy(Storage, ValuePtr, sizeof(Noesis::Point));
+		break;
+	case ETypePropertyDirectAccess::Thickness:
+		FMemory::Memcpy(Storage, ValuePtr, sizeof(Noesis::Thickness));
+		break;
+	default:
+		check(false);
+		break;
+	}
 }
 
 template<class T>
@@ -1338,6 +2195,17 @@ void TypePropertyNoesisObjectWrapper<T>::InternalSet(void* Ptr, const void* Valu
 	check(false);
 }
 
+template<>
+void TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>::InternalSet(void* Ptr, const void* Value) const
+{
+	check(Setter && DirectAccess != ETypePropertyDirectAccess::None);
+	NoesisObjectWrapper* ObjectWrapper = (NoesisObjectWrapper*)Ptr;
+	if (SetDirect(GetValuePtr(Ptr), Value))
+	{
+		ObjectWrapper->NotifyPropertyChanged(GetName());
+	}
+}
+
 template<class T>
 bool TypePropertyNoesisObjectWrapper<T>::InternalIsReadOnly() const
 {
@@ -1366,21 +2234,262 @@ Noesis::Type* UClassTypeCreator(Noesis::Symbol Name)
 	return new NoesisTypeClass(Name);
 }
 
-void UStructTypeFiller(Noesis::Type* Type)
+// Value kinds a reflected property can be exposed as to Noesis
+enum class ENoesisPropertyKind : uint8
+{
+	None,
+	Int,
+	Float,
+	Bool,
+	String,
+	Color,
+	Point,
+	Rect,
+	Size,
+	Thickness,
+	CornerRadius,
+	TimeSpan,
+	Duration,
+	KeyTime,
+	Struct,
+	TextureSource,
+	Object,
+	Enum,
+
+	Count
+};
+
+// How the wrapper reaches the value: a field, an array, a command function or a Get/Set function pair
+enum class ENoesisPropertyAccess : uint8
 {
-	const char* ClassName = Type->GetName();
-	check(RegisterNameMap.Find(NsStringToFString(ClassName)));
-	UScriptStruct* Class = LoadObject<UScriptStruct>(nullptr, **RegisterNameMap.Find(NsStringToFString(ClassName)));
+	ObjectField,
+	ObjectArray,
+	StructField,
+	StructArray,
+	Command,
+	Function,
 
-	const Noesis::TypeClass* ParentType = NoesisStructWrapper::StaticGetClassType(nullptr);
+	Count
+};
 
-	NoesisTypeClass* TypeClass = Noesis::DynamicCast<NoesisTypeClass*>(Type);
-	TypeClass->Class = Class;
-	check(TypeClass);
+typedef Noesis::TypeProperty* (*NoesisTypePropertyFactory)(Noesis::Symbol, const Noesis::Type*, bool, const TypePropertyData&);
 
-	Noesis::TypeClassBuilder* TypeClassBuilder = (Noesis::TypeClassBuilder*)TypeClass;
-	TypeClassBuilder->AddBase(ParentType);
+template<class T>
+struct TNoesisTypePropertyFactories
+{
+	static Noesis::TypeProperty* ObjectField(Noesis::Symbol Id, const Noesis::Type* EnumType, bool IsReadOnly, const TypePropertyData& Data)
+	{
+		return new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Id, EnumType ? EnumType : Noesis::TypeOf<T>(), &NoesisObjectWrapper::GetProperty<T>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<T>, Data);
+	}
+
+	static Noesis::TypeProperty* ObjectArray(Noesis::Symbol Id, const Noesis::Type*, bool IsReadOnly, const TypePropertyData& Data)
+	{
+		return new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Id, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<T>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<T>, Data);
+	}
+
+	static Noesis::TypeProperty* StructField(Noesis::Symbol Id, const Noesis::Type* EnumType, bool, const TypePropertyData& Data)
+	{
+		return new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(Id, EnumType ? EnumType : Noesis::TypeOf<T>(), &NoesisStructWrapper::GetProperty<T>, nullptr, Data);
+	}
+
+	static Noesis::TypeProperty* StructArray(Noesis::Symbol Id, const Noesis::Type*, bool, const TypePropertyData& Data)
+	{
+		return new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(Id, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<T>, nullptr, Data);
+	}
+
+	static Noesis::TypeProperty* Command(Noesis::Symbol Id, const Noesis::Type*, bool, const TypePropertyData& Data)
+	{
+		return new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Id, Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<T>, nullptr, Data);
+	}
+
+	static Noesis::TypeProperty* Function(Noesis::Symbol Id, const Noesis::Type* EnumType, bool IsReadOnly, const TypePropertyData& Data)
+	{
+		return new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Id, EnumType ? EnumType : Noesis::TypeOf<T>(), &NoesisObjectWrapper::GetFunctionProperty<T>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetFunctionProperty<T>, Data);
+	}
+};
+
+Noesis::TypeProperty* CreateCommandTypeProperty(Noesis::Symbol Id, const Noesis::Type*, bool, const TypePropertyData& Data)
+{
+	return new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Id, Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandProperty, nullptr, Data);
+}
+
+// Dispatch tables, filled once. Property classes are keyed by their UClass, structs by their UScriptStruct
+NoesisTypePropertyFactory PropertyFactories[(int32)ENoesisPropertyKind::Count][(int32)ENoesisPropertyAccess::Count];
+TMap<UClass*, ENoesisPropertyKind> PropertyClassKinds;
+TMap<UScriptStruct*, ENoesisPropertyKind> StructKinds;
+
+template<class T>
+void RegisterTypePropertyFactories(ENoesisPropertyKind Kind)
+{
+	NoesisTypePropertyFactory* Factories = PropertyFactories[(int32)Kind];
+	Factories[(int32)ENoesisPropertyAccess::ObjectField] = &TNoesisTypePropertyFactories<T>::ObjectField;
+	Factories[(int32)ENoesisPropertyAccess::ObjectArray] = &TNoesisTypePropertyFactories<T>::ObjectArray;
+	Factories[(int32)ENoesisPropertyAccess::StructField] = &TNoesisTypePropertyFactories<T>::StructField;
+	Factories[(int32)ENoesisPropertyAccess::StructArray] = &TNoesisTypePropertyFactories<T>::StructArray;
+	Factories[(int32)ENoesisPropertyAccess::Command] = &TNoesisTypePropertyFactories<T>::Command;
+	Factories[(int32)ENoesisPropertyAccess::Function] = &TNoesisTypePropertyFactories<T>::Function;
+}
+
+void InitTypePropertyTables()
+{
+	if (PropertyClassKinds.Num() != 0)
+	{
+		return;
+	}
+
+	// Commands without a parameter are the only entries of the None row
+	PropertyFactories[(int32)ENoesisPropertyKind::None][(int32)ENoesisPropertyAccess::Command] = &CreateCommandTypeProperty;
+	RegisterTypePropertyFactories<int>(ENoesisPropertyKind::Int);
+	RegisterTypePropertyFactories<float>(ENoesisPropertyKind::Float);
+	RegisterTypePropertyFactories<bool>(ENoesisPropertyKind::Bool);
+	RegisterTypePropertyFactories<Noesis::String>(ENoesisPropertyKind::String);
+	RegisterTypePropertyFactories<Noesis::Color>(ENoesisPropertyKind::Color);
+	RegisterTypePropertyFactories<Noesis::Point>(ENoesisPropertyKind::Point);
+	RegisterTypePropertyFactories<Noesis::Rect>(ENoesisPropertyKind::Rect);
+	RegisterTypePropertyFactories<Noesis::Size>(ENoesisPropertyKind::Size);
+	RegisterTypePropertyFactories<Noesis::Thickness>(ENoesisPropertyKind::Thickness);
+	RegisterTypePropertyFactories<Noesis::CornerRadius>(ENoesisPropertyKind::CornerRadius);
+	RegisterTypePropertyFactories<Noesis::TimeSpan>(ENoesisPropertyKind::TimeSpan);
+	RegisterTypePropertyFactories<Noesis::Duration>(ENoesisPropertyKind::Duration);
+	RegisterTypePropertyFactories<Noesis::KeyTime>(ENoesisPropertyKind::KeyTime);
+	RegisterTypePropertyFactories<NoesisStructWrapper>(ENoesisPropertyKind::Struct);
+	RegisterTypePropertyFactories<Noesis::TextureSource>(ENoesisPropertyKind::TextureSource);
+	RegisterTypePropertyFactories<NoesisObjectWrapper>(ENoesisPropertyKind::Object);
+	RegisterTypePropertyFactories<NoesisEnumWrapper>(ENoesisPropertyKind::Enum);
+
+	PropertyClassKinds.Add(UIntProperty::StaticClass(), ENoesisPropertyKind::Int);
+	PropertyClassKinds.Add(UFloatProperty::StaticClass(), ENoesisPropertyKind::Float);
+	PropertyClassKinds.Add(UBoolProperty::StaticClass(), ENoesisPropertyKind::Bool);
+	PropertyClassKinds.Add(UStrProperty::StaticClass(), ENoesisPropertyKind::String);
+	PropertyClassKinds.Add(UTextProperty::StaticClass(), ENoesisPropertyKind::String);
+	PropertyClassKinds.Add(UStructProperty::StaticClass(), ENoesisPropertyKind::Struct);
+	PropertyClassKinds.Add(UObjectProperty::StaticClass(), ENoesisPropertyKind::Object);
+	PropertyClassKinds.Add(UEnumProperty::StaticClass(), ENoesisPropertyKind::Enum);
+	PropertyClassKinds.Add(UByteProperty::StaticClass(), ENoesisPropertyKind::Enum);
+
+	StructKinds.Add(TBaseStructure<FColor>::Get(), ENoesisPropertyKind::Color);
+	StructKinds.Add(TBaseStructure<FVector2D>::Get(), ENoesisPropertyKind::Point);
+	StructKinds.Add(FNoesisRect::StaticStruct(), ENoesisPropertyKind::Rect);
+	StructKinds.Add(FNoesisSize::StaticStruct(), ENoesisPropertyKind::Size);
+	StructKinds.Add(FNoesisThickness::StaticStruct(), ENoesisPropertyKind::Thickness);
+	StructKinds.Add(FNoesisCornerRadius::StaticStruct(), ENoesisPropertyKind::CornerRadius);
+	StructKinds.Add(FNoesisTimeSpan::StaticStruct(), ENoesisPropertyKind::TimeSpan);
+	StructKinds.Add(FNoesisDuration::StaticStruct(), ENoesisPropertyKind::Duration);
+	StructKinds.Add(FNoesisKeyTime::StaticStruct(), ENoesisPropertyKind::KeyTime);
+}
+
+UEnum* GetPropertyEnum(UProperty* Property)
+{
+	if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+	{
+		return EnumProperty->GetEnum();
+	}
+	if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
+	{
+		return ByteProperty->Enum;
+	}
+	return nullptr;
+}
+
+ENoesisPropertyKind ResolvePropertyKind(UProperty* Property)
+{
+	check(IsInGameThread());
+	UClass* PropertyClass = Property->GetClass();
+	ENoesisPropertyKind Kind = ENoesisPropertyKind::None;
+	if (ENoesisPropertyKind* KindPtr = PropertyClassKinds.Find(PropertyClass))
+	{
+		Kind = *KindPtr;
+	}
+	else
+	{
+		// Subclasses (e.g. UClassProperty) resolve through their closest registered parent and are cached as well
+		for (UClass* SuperClass = PropertyClass->GetSuperClass(); SuperClass; SuperClass = SuperClass->GetSuperClass())
+		{
+			if (ENoesisPropertyKind* SuperKindPtr = PropertyClassKinds.Find(SuperClass))
+			{
+				Kind = *SuperKindPtr;
+				break;
+			}
+		}
+		PropertyClassKinds.Add(PropertyClass, Kind);
+	}
+
+	switch (Kind)
+	{
+	case ENoesisPropertyKind::Struct:
+	{
+		ENoesisPropertyKind* StructKindPtr = StructKinds.Find(((UStructProperty*)Property)->Struct);
+		return StructKindPtr ? *StructKindPtr : ENoesisPropertyKind::Struct;
+	}
+	case ENoesisPropertyKind::Object:
+	{
+		UClass* ObjectClass = ((UObjectProperty*)Property)->PropertyClass;
+		return ObjectClass == UTexture2D::StaticClass() || ObjectClass == UTextureRenderTarget2D::StaticClass() ? ENoesisPropertyKind::TextureSource : ENoesisPropertyKind::Object;
+	}
+	case ENoesisPropertyKind::Enum:
+		return GetPropertyEnum(Property) ? ENoesisPropertyKind::Enum : ENoesisPropertyKind::None;
+	default:
+		return Kind;
+	}
+}
+
+// Resolved property list of a reflected type. Kept across type registrations, so refilling a type after it was
+// unregistered (PIE, struct or enum edits) replays the table lookups instead of walking the reflection data again
+struct FNoesisTypePropertyEntry
+{
+	FNoesisTypePropertyEntry(Noesis::Symbol InId, ENoesisPropertyKind InKind, ENoesisPropertyAccess InAccess, bool InIsReadOnly, UEnum* InEnum, const TypePropertyData& InData)
+		: Id(InId), Kind(InKind), Access(InAccess), IsReadOnly(InIsReadOnly), Enum(InEnum), Data(InData)
+	{
+	}
+
+	Noesis::Symbol Id;
+	ENoesisPropertyKind Kind;
+	ENoesisPropertyAccess Access;
+	bool IsReadOnly;
+	UEnum* Enum;
+	TypePropertyData Data;
+};
+
+TMap<UStruct*, TArray<FNoesisTypePropertyEntry> > TypePropertyListCache;
+
+void AddTypeProperties(Noesis::TypeClassBuilder* TypeClassBuilder, const TArray<FNoesisTypePropertyEntry>& Entries)
+{
+	for (const FNoesisTypePropertyEntry& Entry : Entries)
+	{
+		NoesisTypePropertyFactory Factory = PropertyFactories[(int32)Entry.Kind][(int32)Entry.Access];
+		check(Factory);
+
+		// Enum types are registered lazily, so they need to be recreated after they were unregistered
+		const Noesis::Type* EnumType = Entry.Enum ? NoesisCreateTypeEnumForUEnum(Entry.Enum) : nullptr;
+		TypeClassBuilder->AddProperty(Factory(Entry.Id, EnumType, Entry.IsReadOnly, Entry.Data));
+	}
+}
+
+void BuildFieldEntries(TArray<FNoesisTypePropertyEntry>& Entries, UProperty* Property, Noesis::Symbol PropertyId, bool IsReadOnly, ENoesisPropertyAccess FieldAccess, ENoesisPropertyAccess ArrayAccess)
+{
+	if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		UProperty* InnerProperty = ArrayProperty->Inner;
+		ENoesisPropertyKind Kind = ResolvePropertyKind(InnerProperty);
+		if (Kind != ENoesisPropertyKind::None)
+		{
+			UEnum* Enum = Kind == ENoesisPropertyKind::Enum ? GetPropertyEnum(InnerProperty) : nullptr;
+			Entries.Emplace(PropertyId, Kind, ArrayAccess, IsReadOnly, Enum, TypePropertyData(ArrayProperty, InnerProperty));
+		}
+	}
+	else
+	{
+		ENoesisPropertyKind Kind = ResolvePropertyKind(Property);
+		if (Kind != ENoesisPropertyKind::None)
+		{
+			UEnum* Enum = Kind == ENoesisPropertyKind::Enum ? GetPropertyEnum(Property) : nullptr;
+			Entries.Emplace(PropertyId, Kind, FieldAccess, IsReadOnly, Enum, TypePropertyData(Property));
+		}
+	}
+}
 
+void BuildStructEntries(TArray<FNoesisTypePropertyEntry>& Entries, UScriptStruct* Class)
+{
 	for (TFieldIterator<UProperty> PropertyIt(Class, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
 	{
 		UProperty* Property = *PropertyIt;
@@ -1395,247 +2504,12 @@ void UStructTypeFiller(Noesis::Type* Type)
 		}
 		Noesis::Symbol PropertyId = Noesis::Symbol(TCHARToNsString(*PropertyName).Str());
 
-		if (Property->IsA<UIntProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<int>(), &NoesisStructWrapper::GetProperty<int>, nullptr, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UFloatProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<float>(), &NoesisStructWrapper::GetProperty<float>, nullptr, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UBoolProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<bool>(), &NoesisStructWrapper::GetProperty<bool>, nullptr, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UStrProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::String>(), &NoesisStructWrapper::GetProperty<Noesis::String>, nullptr, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UTextProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::String>(), &NoesisStructWrapper::GetProperty<Noesis::String>, nullptr, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
-		{
-			if (StructProperty->Struct->GetFName() == NAME_Color)
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::Color>(), &NoesisStructWrapper::GetProperty<Noesis::Color>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetFName() == NAME_Vector2D)
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::Point>(), &NoesisStructWrapper::GetProperty<Noesis::Point>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisRect"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::Rect>(), &NoesisStructWrapper::GetProperty<Noesis::Rect>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisSize"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::Size>(), &NoesisStructWrapper::GetProperty<Noesis::Size>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisThickness"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::Thickness>(), &NoesisStructWrapper::GetProperty<Noesis::Thickness>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisCornerRadius"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::CornerRadius>(), &NoesisStructWrapper::GetProperty<Noesis::CornerRadius>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisTimeSpan"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::TimeSpan>(), &NoesisStructWrapper::GetProperty<Noesis::TimeSpan>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisDuration"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::Duration>(), &NoesisStructWrapper::GetProperty<Noesis::Duration>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisKeyTime"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::KeyTime>(), &NoesisStructWrapper::GetProperty<Noesis::KeyTime>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisStructWrapper>(), &NoesisStructWrapper::GetProperty<NoesisStructWrapper>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-		}
-		else if (UObjectProperty* ObjectProperty = Cast<UObjectProperty>(Property))
-		{
-			if (ObjectProperty->PropertyClass == UTexture2D::StaticClass() || ObjectProperty->PropertyClass == UTextureRenderTarget2D::StaticClass())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<Noesis::TextureSource>(), &NoesisStructWrapper::GetProperty<Noesis::TextureSource>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisObjectWrapper>(), &NoesisStructWrapper::GetProperty<NoesisObjectWrapper>, nullptr, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-		}
-		else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-		{
-			Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(EnumProperty->GetEnum());
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, TypeEnum, &NoesisStructWrapper::GetProperty<NoesisEnumWrapper>, nullptr, TypePropertyData(EnumProperty));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-		{
-			if (ByteProperty->Enum)
-			{
-				Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(ByteProperty->Enum);
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, TypeEnum, &NoesisStructWrapper::GetProperty<NoesisEnumWrapper>, nullptr, TypePropertyData(ByteProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-		}
-		else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
-		{
-			UProperty* InnerProperty = ArrayProperty->Inner;
-			if (InnerProperty->IsA<UIntProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<int>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UFloatProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<float>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UBoolProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<bool>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UStrProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::String>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UTextProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::String>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (UStructProperty* StructInnerProperty = Cast<UStructProperty>(InnerProperty))
-			{
-				if (StructInnerProperty->Struct->GetFName() == NAME_Color)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::Color>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetFName() == NAME_Vector2D)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::Point>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisRect"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::Rect>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisSize"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::Size>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisThickness"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::Thickness>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisCornerRadius"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::CornerRadius>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisTimeSpan"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::TimeSpan>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisDuration"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::Duration>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisKeyTime"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::KeyTime>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<NoesisStructWrapper>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UObjectProperty* ObjectInnerProperty = Cast<UObjectProperty>(InnerProperty))
-			{
-				if (ObjectInnerProperty->PropertyClass == UTexture2D::StaticClass() || ObjectInnerProperty->PropertyClass == UTextureRenderTarget2D::StaticClass())
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<Noesis::TextureSource>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<NoesisObjectWrapper>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UEnumProperty* EnumInnerProperty = Cast<UEnumProperty>(InnerProperty))
-			{
-				NoesisCreateTypeEnumForUEnum(EnumInnerProperty->GetEnum());
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisStructWrapper::GetArrayProperty<NoesisEnumWrapper>, nullptr, TypePropertyData(ArrayProperty, EnumInnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (UByteProperty* ByteInnerProperty = Cast<UByteProperty>(InnerProperty))
-			{
-				if (ByteInnerProperty->Enum)
-				{
-					Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(ByteInnerProperty->Enum);
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisStructWrapper>(PropertyId, TypeEnum, &NoesisStructWrapper::GetArrayProperty<NoesisEnumWrapper>, nullptr, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-
-		}
+		BuildFieldEntries(Entries, Property, PropertyId, true, ENoesisPropertyAccess::StructField, ENoesisPropertyAccess::StructArray);
 	}
 }
 
-void UClassTypeFiller(Noesis::Type* Type)
+void BuildClassEntries(TArray<FNoesisTypePropertyEntry>& Entries, UClass* Class)
 {
-	const char* ClassName = Type->GetName();
-	check(RegisterNameMap.Find(NsStringToFString(ClassName)));
-	UClass* Class = LoadObject<UClass>(nullptr, **RegisterNameMap.Find(NsStringToFString(ClassName)));
-
-	const Noesis::TypeClass* ParentType = NoesisObjectWrapper::StaticGetClassType(nullptr);
-	UClass* SuperClass = Class->GetSuperClass();
-	if (SuperClass)
-	{
-		ParentType = NoesisCreateTypeClassForUClass(SuperClass);
-	}
-
-	NoesisTypeClass* TypeClass = Noesis::DynamicCast<NoesisTypeClass*>(Type);
-	TypeClass->Class = Class;
-	check(TypeClass);
-
-	Noesis::TypeClassBuilder* TypeClassBuilder = (Noesis::TypeClassBuilder*)TypeClass;
-
-	TypeClassBuilder->AddBase(ParentType);
-
 	for (TFieldIterator<UProperty> PropertyIt(Class, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
 	{
 		UProperty* Property = *PropertyIt;
@@ -1643,223 +2517,7 @@ void UClassTypeFiller(Noesis::Type* Type)
 		bool IsReadOnly = Property->HasAllPropertyFlags(CPF_BlueprintReadOnly);
 		Noesis::Symbol PropertyId = Noesis::Symbol(TCHARToNsString(*PropertyName).Str());
 
-		if (Property->IsA<UIntProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<int>(), &NoesisObjectWrapper::GetProperty<int>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<int>, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UFloatProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<float>(), &NoesisObjectWrapper::GetProperty<float>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<float>, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UBoolProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<bool>(), &NoesisObjectWrapper::GetProperty<bool>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<bool>, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UStrProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::String>(), &NoesisObjectWrapper::GetProperty<Noesis::String>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::String>, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (Property->IsA<UTextProperty>())
-		{
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::String>(), &NoesisObjectWrapper::GetProperty<Noesis::String>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::String>, TypePropertyData(Property));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
-		{
-			if (StructProperty->Struct->GetFName() == NAME_Color)
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::Color>(), &NoesisObjectWrapper::GetProperty<Noesis::Color>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::Color>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetFName() == NAME_Vector2D)
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::Point>(), &NoesisObjectWrapper::GetProperty<Noesis::Point>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::Point>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisRect"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::Rect>(), &NoesisObjectWrapper::GetProperty<Noesis::Rect>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::Rect>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisSize"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::Size>(), &NoesisObjectWrapper::GetProperty<Noesis::Size>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::Size>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisThickness"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::Thickness>(), &NoesisObjectWrapper::GetProperty<Noesis::Thickness>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::Thickness>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisCornerRadius"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::CornerRadius>(), &NoesisObjectWrapper::GetProperty<Noesis::CornerRadius>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::CornerRadius>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisTimeSpan"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::TimeSpan>(), &NoesisObjectWrapper::GetProperty<Noesis::TimeSpan>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::TimeSpan>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisDuration"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::Duration>(), &NoesisObjectWrapper::GetProperty<Noesis::Duration>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::Duration>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (StructProperty->Struct->GetName() == TEXT("NoesisKeyTime"))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::KeyTime>(), &NoesisObjectWrapper::GetProperty<Noesis::KeyTime>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::KeyTime>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisStructWrapper>(), &NoesisObjectWrapper::GetProperty<NoesisStructWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<NoesisStructWrapper>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-		}
-		else if (UObjectProperty* ObjectProperty = Cast<UObjectProperty>(Property))
-		{
-			if (ObjectProperty->PropertyClass == UTexture2D::StaticClass() || ObjectProperty->PropertyClass == UTextureRenderTarget2D::StaticClass())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<Noesis::TextureSource>(), &NoesisObjectWrapper::GetProperty<Noesis::TextureSource>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<Noesis::TextureSource>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisObjectWrapper>(), &NoesisObjectWrapper::GetProperty<NoesisObjectWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<NoesisObjectWrapper>, TypePropertyData(Property));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-		}
-		else if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
-		{
-			Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(EnumProperty->GetEnum());
-			Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, TypeEnum, &NoesisObjectWrapper::GetProperty<NoesisEnumWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<NoesisEnumWrapper>, TypePropertyData(EnumProperty));
-			TypeClassBuilder->AddProperty(TypeProperty);
-		}
-		else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
-		{
-			if (ByteProperty->Enum)
-			{
-				Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(ByteProperty->Enum);
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, TypeEnum, &NoesisObjectWrapper::GetProperty<NoesisEnumWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetProperty<NoesisEnumWrapper>, TypePropertyData(ByteProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-		}
-		else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
-		{
-			UProperty* InnerProperty = ArrayProperty->Inner;
-			if (InnerProperty->IsA<UIntProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<int>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<int>, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UFloatProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<float>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<float>, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UBoolProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<bool>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<bool>, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UStrProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::String>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::String>, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (InnerProperty->IsA<UTextProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::String>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::String>, TypePropertyData(ArrayProperty, InnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (UStructProperty* StructInnerProperty = Cast<UStructProperty>(InnerProperty))
-			{
-				if (StructInnerProperty->Struct->GetFName() == NAME_Color)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::Color>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::Color>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetFName() == NAME_Vector2D)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::Point>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::Point>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisRect"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::Rect>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::Rect>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisSize"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::Size>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::Size>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisThickness"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::Thickness>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::Thickness>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisCornerRadius"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::CornerRadius>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::CornerRadius>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisTimeSpan"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::TimeSpan>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::TimeSpan>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisDuration"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::Duration>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::Duration>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructInnerProperty->Struct->GetName() == TEXT("NoesisKeyTime"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::KeyTime>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::KeyTime>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<NoesisStructWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<NoesisStructWrapper>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UObjectProperty* ObjectInnerProperty = Cast<UObjectProperty>(InnerProperty))
-			{
-				if (ObjectInnerProperty->PropertyClass == UTexture2D::StaticClass() || ObjectInnerProperty->PropertyClass == UTextureRenderTarget2D::StaticClass())
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<Noesis::TextureSource>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<Noesis::TextureSource>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<NoesisObjectWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<NoesisObjectWrapper>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UEnumProperty* EnumInnerProperty = Cast<UEnumProperty>(InnerProperty))
-			{
-				NoesisCreateTypeEnumForUEnum(EnumInnerProperty->GetEnum());
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, Noesis::TypeOf<NoesisArrayWrapperBase>(), &NoesisObjectWrapper::GetArrayProperty<NoesisEnumWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<NoesisEnumWrapper>, TypePropertyData(ArrayProperty, EnumInnerProperty));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (UByteProperty* ByteInnerProperty = Cast<UByteProperty>(InnerProperty))
-			{
-				if (ByteInnerProperty->Enum)
-				{
-					Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(ByteInnerProperty->Enum);
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(PropertyId, TypeEnum, &NoesisObjectWrapper::GetArrayProperty<NoesisEnumWrapper>, IsReadOnly ? nullptr : &NoesisObjectWrapper::SetArrayProperty<NoesisEnumWrapper>, TypePropertyData(ArrayProperty, InnerProperty));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-
-		}
+		BuildFieldEntries(Entries, Property, PropertyId, IsReadOnly, ENoesisPropertyAccess::ObjectField, ENoesisPropertyAccess::ObjectArray);
 	}
 
 	for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
@@ -1892,114 +2550,11 @@ void UClassTypeFiller(Noesis::Type* Type)
 				}
 			}
 
-			if (!Param)
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandProperty, nullptr, TypePropertyData(Function, CanExecuteFunction));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (Param->IsA<UIntProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<int>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (Param->IsA<UFloatProperty>())
+			ENoesisPropertyKind Kind = Param ? ResolvePropertyKind(CastChecked<UProperty>(Param)) : ENoesisPropertyKind::None;
+			if (!Param || Kind != ENoesisPropertyKind::None)
 			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<float>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (Param->IsA<UBoolProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<bool>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (Param->IsA<UStrProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::String>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (Param->IsA<UTextProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::String>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (UStructProperty* StructOutParam = Cast<UStructProperty>(Param))
-			{
-				if (StructOutParam->Struct->GetFName() == NAME_Color)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::Color>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetFName() == NAME_Vector2D)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::Point>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisRect"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::Rect>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisSize"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::Size>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisThickness"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::Thickness>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisCornerRadius"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::CornerRadius>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisTimeSpan"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::TimeSpan>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisDuration"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::Duration>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisKeyTime"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::KeyTime>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<NoesisStructWrapper>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UObjectProperty* ObjectOutParam = Cast<UObjectProperty>(Param))
-			{
-				if (ObjectOutParam->PropertyClass == UTexture2D::StaticClass() || ObjectOutParam->PropertyClass == UTextureRenderTarget2D::StaticClass())
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<Noesis::TextureSource>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<NoesisObjectWrapper>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UEnumProperty* EnumOutParam = Cast<UEnumProperty>(Param))
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<NoesisEnumWrapper>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (UByteProperty* ByteOutParam = Cast<UByteProperty>(Param))
-			{
-				if (ByteOutParam->Enum)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str()), Noesis::TypeOf<NoesisFunctionWrapper>(), &NoesisObjectWrapper::GetCommandOneParamProperty<NoesisEnumWrapper>, nullptr, TypePropertyData(Function, CanExecuteFunction));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
+				Noesis::Symbol FunctionId = Noesis::Symbol(TCHARToNsString(*Function->GetName()).Str());
+				Entries.Emplace(FunctionId, Kind, ENoesisPropertyAccess::Command, true, nullptr, TypePropertyData(Function, CanExecuteFunction));
 			}
 		}
 
@@ -2012,121 +2567,94 @@ void UClassTypeFiller(Noesis::Type* Type)
 			UFunction* Setter = Class->FindFunctionByName(*SetterName, EIncludeSuperFlag::ExcludeSuper);
 			if (!Setter || Setter->NumParms != 1 || Setter->HasAnyFunctionFlags(FUNC_HasOutParms) || !CastChecked<UProperty>(Setter->Children)->SameType(OutParam))
 			{
-				Setter = nullptr;
-			}
-
-			if (OutParam->IsA<UIntProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<int>(), &NoesisObjectWrapper::GetFunctionProperty<int>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<int> : nullptr, TypePropertyData(Function, Setter));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (OutParam->IsA<UFloatProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<float>(), &NoesisObjectWrapper::GetFunctionProperty<float>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<float> : nullptr, TypePropertyData(Function, Setter));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (OutParam->IsA<UBoolProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<bool>(), &NoesisObjectWrapper::GetFunctionProperty<bool>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<bool> : nullptr, TypePropertyData(Function, Setter));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (OutParam->IsA<UStrProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::String>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::String>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::String> : nullptr, TypePropertyData(Function, Setter));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (OutParam->IsA<UTextProperty>())
-			{
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::String>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::String>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::String> : nullptr, TypePropertyData(Function, Setter));
-				TypeClassBuilder->AddProperty(TypeProperty);
-			}
-			else if (UStructProperty* StructOutParam = Cast<UStructProperty>(OutParam))
-			{
-				if (StructOutParam->Struct->GetFName() == NAME_Color)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::Color>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::Color>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::Color> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetFName() == NAME_Vector2D)
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::Point>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::Point>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::Point> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisRect"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::Rect>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::Rect>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::Rect> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisSize"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::Size>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::Size>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::Size> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisThickness"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::Thickness>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::Thickness>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::Thickness> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisCornerRadius"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::CornerRadius>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::CornerRadius>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::CornerRadius> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisTimeSpan"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::TimeSpan>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::TimeSpan>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::TimeSpan> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisDuration"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::Duration>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::Duration>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::Duration> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else if (StructOutParam->Struct->GetName() == TEXT("NoesisKeyTime"))
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::KeyTime>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::KeyTime>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::KeyTime> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<NoesisStructWrapper>(), &NoesisObjectWrapper::GetFunctionProperty<NoesisStructWrapper>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<NoesisStructWrapper> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UObjectProperty* ObjectOutParam = Cast<UObjectProperty>(OutParam))
-			{
-				if (ObjectOutParam->PropertyClass == UTexture2D::StaticClass() || ObjectOutParam->PropertyClass == UTextureRenderTarget2D::StaticClass())
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<Noesis::TextureSource>(), &NoesisObjectWrapper::GetFunctionProperty<Noesis::TextureSource>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<Noesis::TextureSource> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-				else
-				{
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), Noesis::TypeOf<NoesisObjectWrapper>(), &NoesisObjectWrapper::GetFunctionProperty<NoesisObjectWrapper>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<NoesisObjectWrapper> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
-			}
-			else if (UEnumProperty* EnumOutParam = Cast<UEnumProperty>(OutParam))
-			{
-				Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(EnumOutParam->GetEnum());
-				Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), TypeEnum, &NoesisObjectWrapper::GetFunctionProperty<NoesisEnumWrapper>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<NoesisEnumWrapper> : nullptr, TypePropertyData(Function, Setter));
-				TypeClassBuilder->AddProperty(TypeProperty);
+				Setter = nullptr;
 			}
-			else if (UByteProperty* ByteOutParam = Cast<UByteProperty>(OutParam))
+
+			ENoesisPropertyKind Kind = ResolvePropertyKind(OutParam);
+			if (Kind != ENoesisPropertyKind::None)
 			{
-				if (ByteOutParam->Enum)
-				{
-					Noesis::TypeEnum* TypeEnum = NoesisCreateTypeEnumForUEnum(ByteOutParam->Enum);
-					Noesis::TypeProperty* TypeProperty = new TypePropertyNoesisObjectWrapper<NoesisObjectWrapper>(Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str()), TypeEnum, &NoesisObjectWrapper::GetFunctionProperty<NoesisEnumWrapper>, Setter ? &NoesisObjectWrapper::SetFunctionProperty<NoesisEnumWrapper> : nullptr, TypePropertyData(Function, Setter));
-					TypeClassBuilder->AddProperty(TypeProperty);
-				}
+				Noesis::Symbol PropertyId = Noesis::Symbol(TCHARToNsString(*Function->GetName().RightChop(3)).Str());
+				UEnum* Enum = Kind == ENoesisPropertyKind::Enum ? GetPropertyEnum(OutParam) : nullptr;
+				Entries.Emplace(PropertyId, Kind, ENoesisPropertyAccess::Function, Setter == nullptr, Enum, TypePropertyData(Function, Setter));
 			}
 		}
 	}
 }
 
+const TArray<FNoesisTypePropertyEntry>& FindOrBuildEntries(UStruct* Struct)
+{
+	check(IsInGameThread());
+	NoesisPurgeDeletedObjects();
+	InitTypePropertyTables();
+	TArray<FNoesisTypePropertyEntry>* Entries = TypePropertyListCache.Find(Struct);
+	if (Entries)
+	{
+		INC_DWORD_STAT(STAT_NoesisTypePropertyListsReused);
+		return *Entries;
+	}
+
+	Entries = &TypePropertyListCache.Add(Struct);
+	FlagObjectKey(Struct);
+	if (UClass* Class = Cast<UClass>(Struct))
+	{
+		BuildClassEntries(*Entries, Class);
+	}
+	else
+	{
+		BuildStructEntries(*Entries, CastChecked<UScriptStruct>(Struct));
+	}
+	return *Entries;
+}
+
+void UStructTypeFiller(Noesis::Type* Type)
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_NoesisTypeClassFill);
+	const char* ClassName = Type->GetName();
+	check(RegisterNameMap.Find(NsStringToFString(ClassName)));
+	UScriptStruct* Class = LoadObject<UScriptStruct>(nullptr, **RegisterNameMap.Find(NsStringToFString(ClassName)));
+
+	const Noesis::TypeClass* ParentType = NoesisStructWrapper::StaticGetClassType(nullptr);
+
+	NoesisTypeClass* TypeClass = Noesis::DynamicCast<NoesisTypeClass*>(Type);
+	TypeClass->Class = Class;
+	check(TypeClass);
+
+	Noesis::TypeClassBuilder* TypeClassBuilder = (Noesis::TypeClassBuilder*)TypeClass;
+	TypeClassBuilder->AddBase(ParentType);
+
+	AddTypeProperties(TypeClassBuilder, FindOrBuildEntries(Class));
+}
+
+void UClassTypeFiller(Noesis::Type* Type)
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_NoesisTypeClassFill);
+	const char* ClassName = Type->GetName();
+	check(RegisterNameMap.Find(NsStringToFString(ClassName)));
+	UClass* Class = LoadObject<UClass>(nullptr, **RegisterNameMap.Find(NsStringToFString(ClassName)));
+
+	const Noesis::TypeClass* ParentType = NoesisObjectWrapper::StaticGetClassType(nullptr);
+	UClass* SuperClass = Class->GetSuperClass();
+	if (SuperClass)
+	{
+		ParentType = NoesisCreateTypeClassForUClass(SuperClass);
+	}
+
+	NoesisTypeClass* TypeClass = Noesis::DynamicCast<NoesisTypeClass*>(Type);
+	TypeClass->Class = Class;
+	check(TypeClass);
+
+	Noesis::TypeClassBuilder* TypeClassBuilder = (Noesis::TypeClassBuilder*)TypeClass;
+
+	TypeClassBuilder->AddBase(ParentType);
+
+	AddTypeProperties(TypeClassBuilder, FindOrBuildEntries(Class));
+}
+
 Noesis::TypeClass* NoesisCreateTypeClassForUClass(UClass* Class)
 {
+	NoesisPurgeDeletedObjects();
 	FString ClassName;
 	if (Class->ClassGeneratedBy)
 	{
@@ -2149,6 +2677,7 @@ Noesis::TypeClass* NoesisCreateTypeClassForUClass(UClass* Class)
 	{
 		TypeClass = Noesis::DynamicCast<Noesis::TypeClass*>(Noesis::Reflection::RegisterType(PersistentClassName, &UClassTypeCreator, &UClassTypeFiller));
 		ClassMap.Add(Class, MakeTuple(TypeClass, PersistentClassName));
+		FlagObjectKey(Class);
 
 #if WITH_EDITOR
 		if (UBlueprint* Blueprint = Cast<UBlueprint>(Class->ClassGeneratedBy))
@@ -2168,6 +2697,7 @@ Noesis::Type* UEnumTypeCreator(Noesis::Symbol Name)
 
 void UEnumTypeFiller(Noesis::Type* Type)
 {
+	check(IsInGameThread());
 	const char* EnumName = Type->GetName();
 	check(RegisterNameMap.Find(NsStringToFString(EnumName)));
 	UEnum* Enum = LoadObject<UEnum>(nullptr, **RegisterNameMap.Find(NsStringToFString(EnumName)));
@@ -2233,6 +2763,9 @@ void NoesisDestroyTypeClassForBlueprint(UBlueprint* Blueprint)
 		Noesis::Reflection::Unregister(TypeClassPtr->Key);
 		ClassMap.Remove(Class);
 	}
+
+	// The blueprint is about to be recompiled, its properties and functions will be different
+	TypePropertyListCache.Remove(Class);
 }
 
 void NoesisDestroyAllTypes()
@@ -2258,6 +2791,17 @@ void NoesisDestroyAllTypes()
 
 	ClassMap.Empty();
 
+	// Cached property lists stay valid for native types and blueprint classes, which are invalidated on compile.
+	// User defined structs are rebuilt in place when edited, so their properties have to be walked again
+	for (auto It = TypePropertyListCache.CreateIterator(); It; ++It)
+	{
+		UScriptStruct* Struct = Cast<UScriptStruct>(It.Key());
+		if (Struct && !(Struct->StructFlags & STRUCT_Native))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
 	for (auto Entry : EnumMap)
 	{
 		auto EnumClassPtr = &Entry.Value;
@@ -2281,11 +2825,16 @@ void AssignStruct(void* BasePointer, UStructProperty* StructProperty, Noesis::Ba
 
 	void* Dest = StructProperty->ContainerPtrToValuePtr<void>(BasePointer);
 	NoesisStructWrapper* Wrapper = ((NoesisStructWrapper*)Value);
-	StructProperty->Struct->CopyScriptStruct(Dest, Wrapper->GetStructPtr(), 1);
+	void* Src = Wrapper->GetStructPtr();
+	if (Src != Dest)
+	{
+		StructProperty->Struct->CopyScriptStruct(Dest, Src, 1);
+	}
 }
 
 Noesis::TypeClass* NoesisCreateTypeClassForUStruct(UScriptStruct* Class)
 {
+	NoesisPurgeDeletedObjects();
 	FString ClassName = Class->GetPathName();
 	FString AnsiClassName(TCHARToNsString(*RegisterNameFromPath(ClassName)).Str());
 	const char* PersistentClassName = GetPersistentName(AnsiClassName);
@@ -2300,6 +2849,7 @@ Noesis::TypeClass* NoesisCreateTypeClassForUStruct(UScriptStruct* Class)
 	{
 		TypeClass = Noesis::DynamicCast<Noesis::TypeClass*>(Noesis::Reflection::RegisterType(PersistentClassName, &UClassTypeCreator, &UStructTypeFiller));
 		ClassMap.Add(Class, MakeTuple(TypeClass, PersistentClassName));
+		FlagObjectKey(Class);
 	}
 
 	return TypeClass;
@@ -2313,11 +2863,9 @@ Noesis::Ptr<Noesis::BaseComponent> NoesisCreateComponentForUStruct(UScriptStruct
 	}
 
 	Noesis::TypeClass* TypeClass = NoesisCreateTypeClassForUStruct(Struct);
-	SIZE_T AllocSize = sizeof(NoesisStructWrapper) + Struct->GetStructureSize();
-	void* Memory = NoesisAlloc(NoesisAllocationCallbackUserData, AllocSize);
-	FMemory::Memzero(Memory, AllocSize);
 	Noesis::Ptr<NoesisStructWrapper> Wrapper = *new NoesisStructWrapper(TypeClass, Struct);
 	Struct->CopyScriptStruct(Wrapper->GetStructPtr(), Src, 1);
+	INC_DWORD_STAT(STAT_NoesisStructCopies);
 
 	return Wrapper;
 }
@@ -2335,6 +2883,7 @@ NOESISRUNTIME_API Noesis::Ptr<Noesis::BaseComponent> NoesisCreateComponentForUOb
 		return BaseComponent->NoesisComponent;
 	}
 
+	NoesisPurgeDeletedObjects();
 	Noesis::Ptr<Noesis::BaseComponent>* ComponentPtr = ObjectMap.Find(Object);
 	if (ComponentPtr)
 	{
@@ -2353,20 +2902,35 @@ NOESISRUNTIME_API Noesis::Ptr<Noesis::BaseComponent> NoesisCreateComponentForUOb
 		Wrapper = *new NoesisObjectWrapper(TypeClass, Object);
 	}
 	ObjectMap.Add(Object, Wrapper);
+	ComponentMap.Add(Wrapper.GetPtr(), Object);
+	FlagObjectKey(Object);
 
 	return Wrapper;
 }
 
 NOESISRUNTIME_API UObject* NoesisCreateUObjectForComponent(Noesis::BaseComponent* Component)
 {
-	UObject* const* ObjectPtr = ObjectMap.FindKey(Noesis::Ptr<Noesis::BaseComponent>(Component));
-	if (ObjectPtr)
+	NoesisPurgeDeletedObjects();
+
+	// Entries are only removed when the UObject is destroyed, skip the ones a GC already found unreachable
+	UObject** ObjectPtr = ComponentMap.Find(Component);
+	if (ObjectPtr && !(*ObjectPtr)->IsUnreachable())
 	{
 		return *ObjectPtr;
 	}
 
+	// The proxy holds a reference to the component, so while it is alive the key can't be reused
+	UNoesisBaseComponent** ProxyPtr = ComponentProxyMap.Find(Component);
+	if (ProxyPtr && !(*ProxyPtr)->IsUnreachable() && !(*ProxyPtr)->IsPendingKill())
+	{
+		return *ProxyPtr;
+	}
+
 	UNoesisBaseComponent* BaseComponent = NewObject<UNoesisBaseComponent>();
 	BaseComponent->NoesisComponent.Reset(Component);
+	ComponentProxyMap.Add(Component, BaseComponent);
+	ProxyComponentMap.Add(BaseComponent, Component);
+	FlagObjectKey(BaseComponent);
 	return BaseComponent;
 }
 
@@ -2380,33 +2944,100 @@ NOESISRUNTIME_API void NoesisCopyUStructFromComponent(UScriptStruct* Struct, Noe
 	Struct->CopyScriptStruct(Dest, Wrapper->GetStructPtr(), 1);
 }
 
+// Property changes are queued and delivered once per (object, property) pair when the views update, in the
+// order they were first notified
+typedef TPair<TWeakObjectPtr<UObject>, FName> FNoesisPropertyChange;
+TArray<FNoesisPropertyChange> PendingPropertyChanges;
+TSet<FNoesisPropertyChange> PendingPropertyChangeSet;
+TMap<FName, Noesis::Symbol> PropertySymbolCache;
+
+static Noesis::Symbol GetPropertySymbol(FName PropertyName)
+{
+	Noesis::Symbol* SymbolPtr = PropertySymbolCache.Find(PropertyName);
+	if (SymbolPtr)
+	{
+		return *SymbolPtr;
+	}
+
+	Noesis::Symbol PropertySymbol(TCHARToNsString(*PropertyName.ToString()).Str());
+	PropertySymbolCache.Add(PropertyName, PropertySymbol);
+	return PropertySymbol;
+}
+
 void NoesisNotifyPropertyChanged(UObject* Owner, FName PropertyName)
 {
 	SCOPE_CYCLE_COUNTER(STAT_NoesisNotifyPropertyChanged);
-	Noesis::Ptr<Noesis::BaseComponent>* WrapperPtr = ObjectMap.Find(Owner);
-	if (WrapperPtr)
+	NoesisPurgeDeletedObjects();
+	if (ObjectMap.Contains(Owner))
 	{
-		NoesisObjectWrapper* Wrapper = (NoesisObjectWrapper*)WrapperPtr->GetPtr();
-		auto PropertySymbol = Noesis::Symbol(TCHARToNsString(*PropertyName.ToString()).Str());
-#if DO_CHECK // Skip in shipping build
-		if (!Wrapper->GetClassType()->FindProperty(PropertySymbol))
+		bool AlreadyPending = false;
+		FNoesisPropertyChange PropertyChange(Owner, PropertyName);
+		PendingPropertyChangeSet.Add(PropertyChange, &AlreadyPending);
+		if (AlreadyPending)
+		{
+			INC_DWORD_STAT(STAT_NoesisPropertyChangedCoalesced);
+		}
+		else
 		{
-			UE_LOG(LogNoesis, Warning, TEXT("Couldn't resolve property %s::%s"), *Owner->GetClass()->GetFName().ToString(), *PropertyName.ToString());
+			PendingPropertyChanges.Add(PropertyChange);
+			((NoesisObjectWrapper*)ObjectMap.FindChecked(Owner).GetPtr())->ChangeListeners.Notify();
 		}
+	}
+}
+
+void NoesisFlushPropertyChanges()
+{
+	SCOPE_CYCLE_COUNTER(STAT_NoesisFlushPropertyChanges);
+	NoesisPurgeDeletedObjects();
+	TArray<TPair<Noesis::Ptr<Noesis::BaseComponent>, Noesis::Symbol> > Notifications;
+	for (;;)
+	{
+		// The queue is taken before delivering it, handlers run arbitrary code and may notify further changes,
+		// which are delivered in the next pass
+		{
+			if (PendingPropertyChanges.Num() == 0)
+				break;
+
+			Notifications.Reset();
+			for (const FNoesisPropertyChange& PropertyChange : PendingPropertyChanges)
+			{
+				UObject* Owner = PropertyChange.Key.Get();
+				Noesis::Ptr<Noesis::BaseComponent>* WrapperPtr = Owner ? ObjectMap.Find(Owner) : nullptr;
+				if (WrapperPtr)
+				{
+					Noesis::Symbol PropertySymbol = GetPropertySymbol(PropertyChange.Value);
+#if DO_CHECK // Skip in shipping build
+					if (!(*WrapperPtr)->GetClassType()->FindProperty(PropertySymbol))
+					{
+						UE_LOG(LogNoesis, Warning, TEXT("Couldn't resolve property %s::%s"), *Owner->GetClass()->GetFName().ToString(), *PropertyChange.Value.ToString());
+					}
 #endif
-		Wrapper->NotifyPropertyChanged(PropertySymbol);
+					Notifications.Emplace(*WrapperPtr, PropertySymbol);
+				}
+			}
+			PendingPropertyChanges.Reset();
+			PendingPropertyChangeSet.Reset();
+		}
+
+		for (auto& Notification : Notifications)
+		{
+			((NoesisObjectWrapper*)Notification.Key.GetPtr())->NotifyPropertyChanged(Notification.Value);
+			INC_DWORD_STAT(STAT_NoesisPropertyChangedIssued);
+		}
 	}
 }
 
 void NoesisNotifyArrayPropertyChanged(UObject* Owner, FName ArrayPropertyName)
 {
 	SCOPE_CYCLE_COUNTER(STAT_NoesisNotifyArrayPropertyChanged);
+	NoesisPurgeDeletedObjects();
 	Noesis::Ptr<Noesis::BaseComponent>* WrapperPtr = ObjectMap.Find(Owner);
 	if (WrapperPtr)
 	{
 		NoesisObjectWrapper* Wrapper = (NoesisObjectWrapper*)WrapperPtr->GetPtr();
+		Wrapper->ChangeListeners.Notify();
 		const Noesis::TypeClass* WrapperTypeClass = Wrapper->GetClassType();
-		const Noesis::TypeProperty* ArrayTypeProperty = WrapperTypeClass->FindProperty(Noesis::Symbol(TCHARToNsString(*ArrayPropertyName.ToString()).Str()));
+		const Noesis::TypeProperty* ArrayTypeProperty = WrapperTypeClass->FindProperty(GetPropertySymbol(ArrayPropertyName));
 		if (ArrayTypeProperty)
 		{
 			NoesisArrayWrapperBase* Array = (NoesisArrayWrapperBase*)(ArrayTypeProperty->GetComponent(Wrapper).GetPtr());
@@ -2431,6 +3062,7 @@ void NoesisNotifyArrayPropertyPostAdd(void* ArrayPointer)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPostAdd();
 	}
 }
@@ -2442,6 +3074,7 @@ void NoesisNotifyArrayPropertyPostChanged(void* ArrayPointer)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPostChanged();
 	}
 }
@@ -2453,6 +3086,7 @@ void NoesisNotifyArrayPropertyPreAppend(void* ArrayPointer)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPreAppend();
 	}
 }
@@ -2464,6 +3098,7 @@ void NoesisNotifyArrayPropertyPostAppend(void* ArrayPointer)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPostAppend();
 	}
 }
@@ -2475,6 +3110,7 @@ void NoesisNotifyArrayPropertyPostInsert(void* ArrayPointer, int32 Index)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPostInsert(Index);
 	}
 }
@@ -2486,6 +3122,7 @@ void NoesisNotifyArrayPropertyPreRemove(void* ArrayPointer, int32 Index)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPreRemoveAt(Index);
 	}
 }
@@ -2497,6 +3134,7 @@ void NoesisNotifyArrayPropertyPostRemove(void* ArrayPointer, int32 Index)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPostRemoveAt(Index);
 	}
 }
@@ -2508,6 +3146,7 @@ void NoesisNotifyArrayPropertyPostClear(void* ArrayPointer)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPostClear();
 	}
 }
@@ -2519,6 +3158,7 @@ void NoesisNotifyArrayPropertyPreSet(void* ArrayPointer, int32 Index)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPreSet(Index);
 	}
 }
@@ -2530,55 +3170,201 @@ void NoesisNotifyArrayPropertyPostSet(void* ArrayPointer, int32 Index)
 	if (ArrayWrapperPtr)
 	{
 		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
 		Array->NotifyPostSet(Index);
 	}
 }
 
+void NoesisNotifyArrayPropertyPostAddRange(void* ArrayPointer, int32 Index, int32 Count)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NoesisNotifyArrayPropertyAdd);
+	NoesisArrayWrapperBase** ArrayWrapperPtr = ArrayMap.Find(ArrayPointer);
+	if (ArrayWrapperPtr)
+	{
+		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
+		Array->NotifyPostInsertRange(Index, Count);
+	}
+}
+
+void NoesisNotifyArrayPropertyPreRemoveRange(void* ArrayPointer, int32 Index, int32 Count)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NoesisNotifyArrayPropertyRemove);
+	NoesisArrayWrapperBase** ArrayWrapperPtr = ArrayMap.Find(ArrayPointer);
+	if (ArrayWrapperPtr)
+	{
+		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
+		Array->NotifyPreRemoveRange(Index, Count);
+	}
+}
+
+void NoesisNotifyArrayPropertyPostRemoveRange(void* ArrayPointer, int32 Index)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NoesisNotifyArrayPropertyRemove);
+	NoesisArrayWrapperBase** ArrayWrapperPtr = ArrayMap.Find(ArrayPointer);
+	if (ArrayWrapperPtr)
+	{
+		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
+		Array->NotifyPostRemoveRange(Index);
+	}
+}
+
+void NoesisNotifyArrayPropertyPostSwap(void* ArrayPointer, int32 IndexA, int32 IndexB)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NoesisNotifyArrayPropertyMove);
+	NoesisArrayWrapperBase** ArrayWrapperPtr = ArrayMap.Find(ArrayPointer);
+	if (ArrayWrapperPtr)
+	{
+		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
+		Array->NotifyPostSwap(IndexA, IndexB);
+	}
+}
+
+void NoesisNotifyArrayPropertyPostReorder(void* ArrayPointer, const TArray<int32>& NewToOldIndices)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NoesisNotifyArrayPropertyMove);
+	NoesisArrayWrapperBase** ArrayWrapperPtr = ArrayMap.Find(ArrayPointer);
+	if (ArrayWrapperPtr)
+	{
+		NoesisArrayWrapperBase* Array = *ArrayWrapperPtr;
+		Array->ChangeListeners.Notify();
+		Array->NotifyPostReorder(NewToOldIndices);
+	}
+}
+
 void NoesisDeleteMaps()
 {
 	ClassMap.Reset();
 
+	TypePropertyListCache.Reset();
+
 	ObjectMap.Reset();
+
+	ComponentMap.Reset();
+
+	ComponentProxyMap.Reset();
+
+	ProxyComponentMap.Reset();
+
+	PendingPropertyChanges.Reset();
+
+	PendingPropertyChangeSet.Reset();
+
+	PropertySymbolCache.Reset();
+
+	DeletedObjects.Empty();
 }
 
-void NoesisGarbageCollected()
+static void NoesisObjectDeleted(const UObjectBase* ObjectBase)
 {
-	if (GIsRunning)
+	// Keys are only compared, the object is already destroyed
+	UObject* Object = (UObject*)ObjectBase;
+	Noesis::Ptr<Noesis::BaseComponent> Wrapper;
+	if (ObjectMap.RemoveAndCopyValue(Object, Wrapper))
+	{
+		ComponentMap.Remove(Wrapper.GetPtr());
+		INC_DWORD_STAT(STAT_NoesisObjectWrappersRemoved);
+	}
+
+	Noesis::BaseComponent* ProxiedComponent;
+	if (ProxyComponentMap.RemoveAndCopyValue(ObjectBase, ProxiedComponent))
 	{
-		SCOPE_CYCLE_COUNTER(STAT_NoesisGarbageCollected);
-		for (auto It = ObjectMap.CreateIterator(); It; ++It)
+		UNoesisBaseComponent** ProxyPtr = ComponentProxyMap.Find(ProxiedComponent);
+		if (ProxyPtr && *ProxyPtr == Object)
 		{
-			auto& ObjectComponentPair = *It;
-			if (ObjectComponentPair.Key->IsUnreachable())
-			{
-				It.RemoveCurrent();
-			}
+			ComponentProxyMap.Remove(ProxiedComponent);
 		}
+		INC_DWORD_STAT(STAT_NoesisComponentProxiesRemoved);
+	}
+
+	TPair<Noesis::TypeClass*, const char*> TypeClassPair;
+	if (ClassMap.RemoveAndCopyValue((UStruct*)Object, TypeClassPair))
+	{
+		Noesis::Reflection::Unregister(TypeClassPair.Key);
+		INC_DWORD_STAT(STAT_NoesisTypeClassesRemoved);
+	}
+
+	TypePropertyListCache.Remove((UStruct*)Object);
+}
 
-		for (auto It = ClassMap.CreateIterator(); It; ++It)
+void NoesisPurgeDeletedObjects()
+{
+	check(IsInGameThread());
+	if (DeletedObjects.IsEmpty())
+		return;
+
+	SCOPE_CYCLE_COUNTER(STAT_NoesisPurgeDeletedObjects);
+	const UObjectBase* Object;
+	while (DeletedObjects.Dequeue(Object))
+	{
+		NoesisObjectDeleted(Object);
+	}
+}
+
+// Visits only the objects that are actually destroyed, instead of scanning the maps after every GC
+class FNoesisObjectDeleteListener : public FUObjectArray::FUObjectDeleteListener
+{
+public:
+	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override
+	{
+		// The index is only freed after the listeners are notified, so the flag is cleared before it can be reused
+		if (ObjectKeyFlags.IsValidIndex(Index) && ObjectKeyFlags[Index])
 		{
-			auto& ClassTypeClassPair = *It;
-			if (ClassTypeClassPair.Key->IsUnreachable())
-			{
-				Noesis::Reflection::Unregister(ClassTypeClassPair.Value.Key);
-				It.RemoveCurrent();
-			}
+			ObjectKeyFlags[Index] = 0;
+			DeletedObjects.Enqueue(Object);
 		}
 	}
+
+	virtual void OnUObjectArrayShutdown() override
+	{
+		GUObjectArray.RemoveUObjectDeleteListener(this);
+	}
+};
+
+FNoesisObjectDeleteListener NoesisObjectDeleteListener;
+FDelegateHandle PostGarbageCollectHandle;
+
+void NoesisRegisterObjectDeleteListener()
+{
+	ObjectKeyFlags.SetNumZeroed(GUObjectArray.GetObjectArrayCapacity());
+	GUObjectArray.AddUObjectDeleteListener(&NoesisObjectDeleteListener);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&NoesisPurgeDeletedObjects);
+}
+
+void NoesisUnregisterObjectDeleteListener()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+	GUObjectArray.RemoveUObjectDeleteListener(&NoesisObjectDeleteListener);
+	NoesisPurgeDeletedObjects();
+	ObjectKeyFlags.Empty();
 }
 
+// Asset classes whose assets define types, with the suffix that turns the asset path into the type path
+TMap<FName, const TCHAR*> TypeAssetClasses;
+FDelegateHandle CompiledInUObjectsRegisteredHandle;
+FDelegateHandle AssetAddedHandle;
+FDelegateHandle AssetRemovedHandle;
+FDelegateHandle AssetRenamedHandle;
+
 void NoesisReflectionRegistryCallback(Noesis::Symbol Name)
 {
+	check(IsInGameThread());
 	const char* TypeName = Name.Str();
+
+	// Once built, the index is kept up to date by the NoesisRegisterTypes listeners, so a miss means the type doesn't exist
+	if (!CompiledInUObjectsRegisteredHandle.IsValid())
+	{
+		NoesisRegisterTypes();
+	}
+
 	FString* ObjectPath = RegisterNameMap.Find(NsStringToFString(TypeName));
 	if (!ObjectPath)
 	{
-		NoesisRegisterTypes();
-		ObjectPath = RegisterNameMap.Find(NsStringToFString(TypeName));
-		if (!ObjectPath)
-		{
-			return;
-		}
+		return;
 	}
 
 	UObject* Object = LoadObject<UObject>(nullptr, **ObjectPath);
@@ -2600,11 +3386,10 @@ void NoesisReflectionRegistryCallback(Noesis::Symbol Name)
 	}
 }
 
-void NoesisRegisterTypes()
+static void RegisterTypeObject(UObject* Object)
 {
-	for (TObjectIterator<UClass> It; It; ++It)
+	if (UClass* Class = Cast<UClass>(Object))
 	{
-		UClass* Class = *It;
 		if (Class->ClassGeneratedBy)
 		{
 			UBlueprint* Blueprint = Cast<UBlueprint>(Class->ClassGeneratedBy);
@@ -2618,46 +3403,131 @@ void NoesisRegisterTypes()
 			RegisterNameMap.Add(RegisterName, Class->GetPathName());
 		}
 	}
-
-	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	else if (UScriptStruct* Struct = Cast<UScriptStruct>(Object))
 	{
-		UScriptStruct* Struct = *It;
-
 		FString RegisterName = RegisterNameFromPath(Struct->GetPathName());
 		RegisterNameMap.Add(RegisterName, Struct->GetPathName());
 	}
-
-	for (TObjectIterator<UEnum> It; It; ++It)
+	else if (UEnum* Enum = Cast<UEnum>(Object))
 	{
-		UEnum* Enum = *It;
-
 		FString RegisterName = RegisterNameFromPath(Enum->GetPathName());
 		RegisterNameMap.Add(RegisterName, Enum->GetPathName());
 	}
+}
+
+static void RegisterTypeAsset(const FAssetData& Asset)
+{
+	const TCHAR** Suffix = TypeAssetClasses.Find(Asset.AssetClass);
+	if (Suffix)
+	{
+		FString RegisterName = RegisterNameFromPath(Asset.ObjectPath.ToString());
+		RegisterNameMap.Add(RegisterName, Asset.ObjectPath.ToString() + *Suffix);
+	}
+}
+
+static void UnregisterTypeAsset(const FString& AssetClass, const FString& ObjectPath)
+{
+	const TCHAR** Suffix = TypeAssetClasses.Find(FName(*AssetClass));
+	if (Suffix)
+	{
+		FString RegisterName = RegisterNameFromPath(ObjectPath);
+		FString* RegisteredPath = RegisterNameMap.Find(RegisterName);
+		if (RegisteredPath && *RegisteredPath == ObjectPath + *Suffix)
+		{
+			RegisterNameMap.Remove(RegisterName);
+		}
+	}
+}
+
+static void OnCompiledInUObjectsRegistered(FName PackageName)
+{
+	UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+	if (Package)
+	{
+		ForEachObjectWithOuter(Package, &RegisterTypeObject, false);
+	}
+}
+
+static void OnTypeAssetAdded(const FAssetData& Asset)
+{
+	RegisterTypeAsset(Asset);
+}
+
+static void OnTypeAssetRemoved(const FAssetData& Asset)
+{
+	UnregisterTypeAsset(Asset.AssetClass.ToString(), Asset.ObjectPath.ToString());
+}
+
+static void OnTypeAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+	UnregisterTypeAsset(Asset.AssetClass.ToString(), OldObjectPath);
+	RegisterTypeAsset(Asset);
+}
+
+void NoesisRegisterTypes()
+{
+	// Build the index once, then keep it current from module and asset registry notifications
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		RegisterTypeObject(Class);
+
+		if (Class->IsChildOf(UBlueprint::StaticClass()))
+		{
+			TypeAssetClasses.Add(Class->GetFName(), TEXT("_C"));
+		}
+		else if (Class->IsChildOf(UUserDefinedStruct::StaticClass()) || Class->IsChildOf(UUserDefinedEnum::StaticClass()))
+		{
+			TypeAssetClasses.Add(Class->GetFName(), TEXT(""));
+		}
+	}
+
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		RegisterTypeObject(*It);
+	}
+
+	for (TObjectIterator<UEnum> It; It; ++It)
+	{
+		RegisterTypeObject(*It);
+	}
 
 	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 	TArray<FAssetData> Assets;
 
-	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetFName(), Assets, true);
-	for (auto Asset : Assets)
+	FARFilter Filter;
+	Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+	Filter.ClassNames.Add(UUserDefinedStruct::StaticClass()->GetFName());
+	Filter.ClassNames.Add(UUserDefinedEnum::StaticClass()->GetFName());
+	Filter.bRecursiveClasses = true;
+	AssetRegistry.GetAssets(Filter, Assets);
+	for (auto& Asset : Assets)
 	{
-		FString RegisterName = RegisterNameFromPath(Asset.ObjectPath.ToString());
-		RegisterNameMap.Add(RegisterName, Asset.ObjectPath.ToString() + TEXT("_C"));
+		RegisterTypeAsset(Asset);
 	}
 
-	Assets.Empty();
-	AssetRegistry.GetAssetsByClass(UUserDefinedStruct::StaticClass()->GetFName(), Assets, true);
-	for (auto Asset : Assets)
+	if (!CompiledInUObjectsRegisteredHandle.IsValid())
 	{
-		FString RegisterName = RegisterNameFromPath(Asset.ObjectPath.ToString());
-		RegisterNameMap.Add(RegisterName, Asset.ObjectPath.ToString());
+		CompiledInUObjectsRegisteredHandle = FCoreUObjectDelegates::CompiledInUObjectsRegisteredDelegate.AddStatic(&OnCompiledInUObjectsRegistered);
+		AssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&OnTypeAssetAdded);
+		AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&OnTypeAssetRemoved);
+		AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&OnTypeAssetRenamed);
 	}
+}
+
+void NoesisUnregisterTypes()
+{
+	FCoreUObjectDelegates::CompiledInUObjectsRegisteredDelegate.Remove(CompiledInUObjectsRegisteredHandle);
+	CompiledInUObjectsRegisteredHandle.Reset();
 
-	Assets.Empty();
-	AssetRegistry.GetAssetsByClass(UUserDefinedEnum::StaticClass()->GetFName(), Assets, true);
-	for (auto Asset : Assets)
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
 	{
-		FString RegisterName = RegisterNameFromPath(Asset.ObjectPath.ToString());
-		RegisterNameMap.Add(RegisterName, Asset.ObjectPath.ToString());
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
 	}
+	AssetAddedHandle.Reset();
+	AssetRemovedHandle.Reset();
+	AssetRenamedHandle.Reset();
 }
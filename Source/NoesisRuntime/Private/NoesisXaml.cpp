@@ -5,6 +5,162 @@
 
 #include "NoesisXaml.h"
 
+// Core includes
+#include "Misc/Parse.h"
+
+// Engine includes
+#include "Engine/Texture2D.h"
+
+// RenderCore includes
+#include "RenderingThread.h"
+
+// NoesisRuntime includes
+#include "NoesisRuntimeModule.h"
+#include "NoesisSettings.h"
+#include "Render/NoesisRenderDevice.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisXamlTemplateHits"), STAT_NoesisXamlTemplateHits, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisXamlTemplateMisses"), STAT_NoesisXamlTemplateMisses, STATGROUP_Noesis);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NoesisXamlTemplateBytes"), STAT_NoesisXamlTemplateBytes, STATGROUP_Noesis);
+DECLARE_CYCLE_STAT(TEXT("NoesisPrewarmGlyphs"), STAT_NoesisPrewarmGlyphs, STATGROUP_Noesis);
+
+struct FNoesisXamlTemplate
+{
+	Noesis::Ptr<Noesis::FrameworkTemplate> Template;
+	int64 Size;
+	uint64 LastUse;
+};
+
+// Templates are keyed by the path of the XAML, which relative URIs resolve against, and by its content hash, so
+// a reimported XAML doesn't get the template of its previous version. The size accounted is the Noesis memory
+// the template kept after it was parsed
+typedef TPair<FString, uint32> FNoesisXamlTemplateKey;
+static TMap<FNoesisXamlTemplateKey, FNoesisXamlTemplate> XamlTemplates;
+static TSet<FNoesisXamlTemplateKey> NonTemplateXamls;
+static int64 XamlTemplatesSize = 0;
+static uint64 XamlTemplatesUseCount = 0;
+
+// Extension used to ask the XamlProvider for the template version of a XAML. Keeping the rest of the path
+// unchanged makes relative URIs inside the template resolve the same way
+static const TCHAR XamlTemplateExtension[] = TEXT("NoesisTemplate");
+
+// Same for the XAML generated to rasterize the glyph sets, so relative font URIs resolve as in the original
+static const TCHAR XamlGlyphsExtension[] = TEXT("NoesisGlyphs");
+
+// Size of the view the glyph sets are laid out in. Characters wrapping past its bottom are not rasterized, so
+// large sets are split across several passes
+static const uint32 GlyphsViewSize = 1024;
+
+// Characters of a glyph set laid out in each pass. The view fits about (GlyphsViewSize / FontSize)^2 glyphs one
+// em wide with a line height of 1.5 em, half of that is kept as margin for wider glyphs and partial lines
+static int32 GetGlyphsPerPass(const FNoesisGlyphSet& GlyphSet)
+{
+	float FontSize = GlyphSet.FontSize > 0.f ? GlyphSet.FontSize : 12.f;
+	int32 Columns = FMath::Max(FMath::FloorToInt(GlyphsViewSize / FontSize), 1);
+	int32 Rows = FMath::Max(FMath::FloorToInt(GlyphsViewSize / (FontSize * 1.5f)), 1);
+	return FMath::Max(Columns * Rows / 2, 1);
+}
+
+static bool ContainsText(const TArray<uint8>& Text, const char* Token)
+{
+	int32 Length = FCStringAnsi::Strlen(Token);
+	for (int32 Index = 0; Index + Length <= Text.Num(); ++Index)
+	{
+		if (FMemory::Memcmp(Text.GetData() + Index, Token, Length) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// Roots with code-behind can't live inside a template
+static bool CanBeTemplate(const TArray<uint8>& Text)
+{
+	return !ContainsText(Text, "x:Class");
+}
+
+// Values of the Name and x:Name attributes in the XAML, including the ones of nested templates
+static void CollectXamlNames(const TArray<uint8>& Text, TArray<FString>& OutNames)
+{
+	static const char NameAttribute[] = "Name=";
+	const int32 Length = sizeof(NameAttribute) - 1;
+	for (int32 Index = 1; Index + Length < Text.Num(); ++Index)
+	{
+		uint8 Previous = Text[Index - 1];
+		if ((Previous == ':' || FChar::IsWhitespace(Previous)) && FMemory::Memcmp(Text.GetData() + Index, NameAttribute, Length) == 0)
+		{
+			uint8 Quote = Text[Index + Length];
+			int32 Start = Index + Length + 1;
+			int32 End = Start;
+			while (End < Text.Num() && Text[End] != Quote)
+			{
+				++End;
+			}
+			if ((Quote == '"' || Quote == '\'') && End < Text.Num())
+			{
+				FUTF8ToTCHAR Name((const ANSICHAR*)Text.GetData() + Start, End - Start);
+				OutNames.AddUnique(FString(Name.Length(), Name.Get()));
+			}
+			Index = End;
+		}
+	}
+}
+
+// Content loaded from a template registers its names in a namescope of its own. The template is only used if
+// every name FindName resolves in the parsed root also resolves in a root cloned from the template
+static bool ResolvesSameNames(const TArray<uint8>& Text, Noesis::FrameworkElement* Root, Noesis::FrameworkTemplate* Template)
+{
+	TArray<FString> Names;
+	CollectXamlNames(Text, Names);
+	if (Names.Num() == 0)
+	{
+		return true;
+	}
+
+	Noesis::Ptr<Noesis::FrameworkElement> Clone(Template->LoadContent(nullptr));
+	if (!Clone)
+	{
+		return false;
+	}
+
+	for (const FString& Name : Names)
+	{
+		if (Root->FindName(TCHARToNsString(*Name).Str()) != nullptr && Clone->FindName(TCHARToNsString(*Name).Str()) == nullptr)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static void EvictXamlTemplates(int64 Budget, const FNoesisXamlTemplateKey& KeepKey)
+{
+	while (XamlTemplatesSize > Budget)
+	{
+		const FNoesisXamlTemplateKey* OldestKey = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const auto& Pair : XamlTemplates)
+		{
+			if (Pair.Key != KeepKey && Pair.Value.LastUse < OldestUse)
+			{
+				OldestKey = &Pair.Key;
+				OldestUse = Pair.Value.LastUse;
+			}
+		}
+
+		if (OldestKey == nullptr)
+		{
+			break;
+		}
+
+		FNoesisXamlTemplateKey Key = *OldestKey;
+		XamlTemplatesSize -= XamlTemplates.FindChecked(Key).Size;
+		XamlTemplates.Remove(Key);
+	}
+	SET_DWORD_STAT(STAT_NoesisXamlTemplateBytes, XamlTemplatesSize);
+}
+
 UNoesisXaml::UNoesisXaml(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -27,6 +183,318 @@ uint32 UNoesisXaml::GetContentHash() const
 	return Noesis::HashBytes(XamlText.GetData(), XamlText.Num());
 }
 
+Noesis::Ptr<Noesis::FrameworkElement> UNoesisXaml::InstantiateXaml()
+{
+	int64 Budget = (int64)GetDefault<UNoesisSettings>()->XamlTemplateCacheBudget * 1024;
+	if (Budget > 0 && !HasAnyFlags(RF_ClassDefaultObject))
+	{
+		check(IsInGameThread());
+		FNoesisXamlTemplateKey Key(GetPathName(), GetContentHash());
+		FNoesisXamlTemplate* Entry = XamlTemplates.Find(Key);
+		if (Entry == nullptr && !NonTemplateXamls.Contains(Key))
+		{
+			// The first instance is parsed as usual, and tells whether the template can stand in for it
+			Noesis::Ptr<Noesis::FrameworkElement> Root(Noesis::DynamicCast<Noesis::FrameworkElement*>(LoadXaml().GetPtr()));
+			int64 TemplateSize = 0;
+			Noesis::Ptr<Noesis::FrameworkTemplate> Template = Root ? LoadTemplate(TemplateSize) : nullptr;
+			if (Template && TemplateSize <= Budget && ResolvesSameNames(XamlText, Root.GetPtr(), Template.GetPtr()))
+			{
+				INC_DWORD_STAT(STAT_NoesisXamlTemplateMisses);
+				XamlTemplates.Add(Key, FNoesisXamlTemplate{ Template, TemplateSize, ++XamlTemplatesUseCount });
+				XamlTemplatesSize += TemplateSize;
+				EvictXamlTemplates(Budget, Key);
+			}
+			else
+			{
+				NonTemplateXamls.Add(Key);
+			}
+			return Root;
+		}
+
+		if (Entry != nullptr)
+		{
+			INC_DWORD_STAT(STAT_NoesisXamlTemplateHits);
+			Entry->LastUse = ++XamlTemplatesUseCount;
+			Noesis::Ptr<Noesis::FrameworkElement> Root(Entry->Template->LoadContent(nullptr));
+			if (Root)
+			{
+				return Root;
+			}
+		}
+	}
+
+	return Noesis::Ptr<Noesis::FrameworkElement>(Noesis::DynamicCast<Noesis::FrameworkElement*>(LoadXaml().GetPtr()));
+}
+
+Noesis::Ptr<Noesis::FrameworkTemplate> UNoesisXaml::LoadTemplate(int64& OutSize)
+{
+	if (!CanBeTemplate(XamlText))
+	{
+		return nullptr;
+	}
+
+	// The template element goes after the byte order mark and the XML declaration, if any
+	static const char TemplateBegin[] = "<DataTemplate xmlns=\"http://schemas.microsoft.com/winfx/2006/xaml/presentation\">";
+	static const char TemplateEnd[] = "</DataTemplate>";
+	int32 Start = 0;
+	if (XamlText.Num() >= 3 && XamlText[0] == 0xEF && XamlText[1] == 0xBB && XamlText[2] == 0xBF)
+	{
+		Start = 3;
+	}
+	if (XamlText.Num() - Start >= 5 && FMemory::Memcmp(XamlText.GetData() + Start, "<?xml", 5) == 0)
+	{
+		while (Start + 1 < XamlText.Num() && !(XamlText[Start] == '?' && XamlText[Start + 1] == '>'))
+		{
+			++Start;
+		}
+		Start = FMath::Min(Start + 2, XamlText.Num());
+	}
+
+	TemplateText.Reset(XamlText.Num() + sizeof(TemplateBegin) + sizeof(TemplateEnd));
+	TemplateText.Append(XamlText.GetData(), Start);
+	TemplateText.Append((const uint8*)TemplateBegin, sizeof(TemplateBegin) - 1);
+	TemplateText.Append(XamlText.GetData() + Start, XamlText.Num() - Start);
+	TemplateText.Append((const uint8*)TemplateEnd, sizeof(TemplateEnd) - 1);
+
+	// What the parser allocated and didn't free is what the template keeps alive. The renderers can allocate
+	// meanwhile on the render thread, so this is an estimate, which is all the cache budget needs
+	FString TemplatePath = FPaths::GetPath(GetPathName()) / GetName() + TEXT(".") + XamlTemplateExtension;
+	int64 AllocatedBefore = (int64)Noesis::GetAllocatedMemory();
+	Noesis::Ptr<Noesis::BaseComponent> Component = Noesis::GUI::LoadXaml(TCHARToNsString(*TemplatePath).Str());
+	int64 AllocatedBytes = (int64)Noesis::GetAllocatedMemory() - AllocatedBefore;
+	TemplateText.Empty();
+	OutSize = FMath::Max<int64>(AllocatedBytes, XamlText.Num());
+
+	return Noesis::Ptr<Noesis::FrameworkTemplate>(Noesis::DynamicCast<Noesis::FrameworkTemplate*>(Component.GetPtr()));
+}
+
+const TArray<uint8>& UNoesisXaml::GetProviderText(const FString& ProviderPath) const
+{
+	FString Extension = FPaths::GetExtension(ProviderPath);
+	if (Extension == XamlTemplateExtension && TemplateText.Num() != 0)
+	{
+		return TemplateText;
+	}
+	if (Extension == XamlGlyphsExtension && GlyphsText.Num() != 0)
+	{
+		return GlyphsText;
+	}
+	return XamlText;
+}
+
+void UNoesisXaml::ClearTemplateCache()
+{
+	XamlTemplates.Empty();
+	NonTemplateXamls.Empty();
+	XamlTemplatesSize = 0;
+	SET_DWORD_STAT(STAT_NoesisXamlTemplateBytes, 0);
+}
+
+static void AppendXmlAttribute(FString& Xaml, const TCHAR* Name, const FString& Value)
+{
+	Xaml += FString::Printf(TEXT(" %s=\""), Name);
+	if (Value.StartsWith(TEXT("{")))
+	{
+		Xaml += TEXT("{}");
+	}
+	for (TCHAR Character : Value)
+	{
+		switch (Character)
+		{
+			case TEXT('&'): Xaml += TEXT("&amp;"); break;
+			case TEXT('<'): Xaml += TEXT("&lt;"); break;
+			case TEXT('"'): Xaml += TEXT("&quot;"); break;
+			default: Xaml.AppendChar(Character); break;
+		}
+	}
+	Xaml += TEXT("\"");
+}
+
+void UNoesisXaml::CollectGlyphXamls(TArray<UNoesisXaml*>& OutXamls, TSet<UNoesisXaml*>& Visited)
+{
+	bool AlreadyVisited = false;
+	Visited.Add(this, &AlreadyVisited);
+	if (AlreadyVisited)
+	{
+		return;
+	}
+
+	if (GlyphSets.Num() != 0)
+	{
+		OutXamls.Add(this);
+	}
+
+	for (auto Xaml : Xamls)
+	{
+		if (Xaml)
+		{
+			Xaml->CollectGlyphXamls(OutXamls, Visited);
+		}
+	}
+}
+
+// The part of each glyph set laid out in the given pass, false once every character was laid out
+bool UNoesisXaml::GetGlyphsPass(int32 Pass, TArray<FNoesisGlyphSet>& OutGlyphSets) const
+{
+	OutGlyphSets.Reset();
+	for (const FNoesisGlyphSet& GlyphSet : GlyphSets)
+	{
+		int32 GlyphsPerPass = GetGlyphsPerPass(GlyphSet);
+		int32 Start = Pass * GlyphsPerPass;
+		if (Start >= GlyphSet.Characters.Len())
+			continue;
+
+		// Surrogate pairs are kept in the same pass
+		if (Start > 0 && FChar::IsHighSurrogate(GlyphSet.Characters[Start - 1]))
+		{
+			++Start;
+		}
+		int32 End = FMath::Min(Start + GlyphsPerPass, GlyphSet.Characters.Len());
+		if (End < GlyphSet.Characters.Len() && FChar::IsHighSurrogate(GlyphSet.Characters[End - 1]))
+		{
+			++End;
+		}
+		if (Start >= End)
+			continue;
+
+		FNoesisGlyphSet& PassGlyphSet = OutGlyphSets.Add_GetRef(GlyphSet);
+		PassGlyphSet.Characters = GlyphSet.Characters.Mid(Start, End - Start);
+	}
+	return OutGlyphSets.Num() != 0;
+}
+
+Noesis::Ptr<Noesis::BaseComponent> UNoesisXaml::LoadGlyphsXaml(const TArray<FNoesisGlyphSet>& PassGlyphSets)
+{
+	// One wrapping TextBlock per glyph set, all of them on top of each other
+	FString Xaml = TEXT("<Grid xmlns=\"http://schemas.microsoft.com/winfx/2006/xaml/presentation\">");
+	for (const FNoesisGlyphSet& GlyphSet : PassGlyphSets)
+	{
+		Xaml += TEXT("<TextBlock TextWrapping=\"Wrap\"");
+		if (!GlyphSet.FontFamily.IsEmpty())
+		{
+			AppendXmlAttribute(Xaml, TEXT("FontFamily"), GlyphSet.FontFamily);
+		}
+		if (!GlyphSet.FontWeight.IsEmpty())
+		{
+			AppendXmlAttribute(Xaml, TEXT("FontWeight"), GlyphSet.FontWeight);
+		}
+		if (!GlyphSet.FontStyle.IsEmpty())
+		{
+			AppendXmlAttribute(Xaml, TEXT("FontStyle"), GlyphSet.FontStyle);
+		}
+		if (GlyphSet.FontSize > 0.f)
+		{
+			AppendXmlAttribute(Xaml, TEXT("FontSize"), FString::SanitizeFloat(GlyphSet.FontSize));
+		}
+		AppendXmlAttribute(Xaml, TEXT("Text"), GlyphSet.Characters);
+		Xaml += TEXT("/>");
+	}
+	Xaml += TEXT("</Grid>");
+
+	FTCHARToUTF8 XamlUTF8(*Xaml);
+	GlyphsText.Reset(XamlUTF8.Length());
+	GlyphsText.Append((const uint8*)XamlUTF8.Get(), XamlUTF8.Length());
+
+	// Loaded from this XAML's folder, so the font URIs resolve the same way they do in the XAML
+	FString GlyphsPath = FPaths::GetPath(GetPathName()) / GetName() + TEXT(".") + XamlGlyphsExtension;
+	Noesis::Ptr<Noesis::BaseComponent> Component = Noesis::GUI::LoadXaml(TCHARToNsString(*GlyphsPath).Str());
+	GlyphsText.Empty();
+
+	return Component;
+}
+
+static void RenderGlyphsView(Noesis::IView* View)
+{
+	// The renderer is released on the render thread once it has drawn, like the ones of the instances
+	Noesis::Ptr<Noesis::IRenderer> Renderer(View->GetRenderer());
+	ENQUEUE_RENDER_COMMAND(FNoesisXaml_PrewarmGlyphs)
+	(
+		[Renderer](FRHICommandListImmediate& RHICmdList)
+		{
+			FNoesisRenderDevice* RenderDevice = FNoesisRenderDevice::Get();
+			Renderer->Init(RenderDevice);
+			FNoesisRenderDevice::ThreadLocal_SetRHICmdList(&RHICmdList);
+			Renderer->UpdateRenderTree();
+			Renderer->RenderOffscreen();
+
+			FTexture2DRHIRef ColorTarget;
+			FTexture2DRHIRef ShaderResourceTexture;
+			RenderDevice->RenderTargetPool.FindFreeRenderTarget(GlyphsViewSize, GlyphsViewSize, PF_B8G8R8A8, 1, ColorTarget, ShaderResourceTexture);
+			FTexture2DRHIRef DepthStencilTarget = RenderDevice->RenderTargetPool.FindFreeDepthStencil(GlyphsViewSize, GlyphsViewSize, 1);
+			FRHIRenderPassInfo RPInfo(ColorTarget, ERenderTargetActions::DontLoad_DontStore, DepthStencilTarget,
+				MakeDepthStencilTargetActions(ERenderTargetActions::DontLoad_DontStore, ERenderTargetActions::Clear_DontStore), FExclusiveDepthStencil::DepthNop_StencilWrite);
+
+			check(RHICmdList.IsOutsideRenderPass());
+			RHICmdList.BeginRenderPass(RPInfo, TEXT("NoesisPrewarmGlyphs"));
+			RHICmdList.SetViewport(0, 0, 0.0f, GlyphsViewSize, GlyphsViewSize, 1.0f);
+			Renderer->Render(false);
+			RHICmdList.EndRenderPass();
+
+			FNoesisRenderDevice::ThreadLocal_SetRHICmdList(nullptr);
+			Renderer->Shutdown();
+		}
+	);
+}
+
+void UNoesisXaml::PrewarmGlyphs()
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_NoesisPrewarmGlyphs);
+
+	TArray<UNoesisXaml*> GlyphXamls;
+	TSet<UNoesisXaml*> Visited;
+	CollectGlyphXamls(GlyphXamls, Visited);
+	if (GlyphXamls.Num() == 0 || HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return;
+	}
+
+	// Each pass lays out the glyphs of each XAML, all of them on top of each other. Drawing them once makes the
+	// renderer rasterize every glyph into the glyph cache, which is shared by all the views
+	TArray<FNoesisGlyphSet> PassGlyphSets;
+	for (int32 Pass = 0;; ++Pass)
+	{
+		Noesis::Ptr<Noesis::Grid> Root = *new Noesis::Grid();
+		for (UNoesisXaml* GlyphXaml : GlyphXamls)
+		{
+			if (!GlyphXaml->GetGlyphsPass(Pass, PassGlyphSets))
+				continue;
+
+			Noesis::Ptr<Noesis::BaseComponent> Component = GlyphXaml->LoadGlyphsXaml(PassGlyphSets);
+			Noesis::FrameworkElement* Element = Noesis::DynamicCast<Noesis::FrameworkElement*>(Component.GetPtr());
+			if (Element == nullptr)
+			{
+				UE_LOG(LogNoesis, Warning, TEXT("Couldn't prewarm the glyphs of %s"), *GlyphXaml->GetPathName());
+				continue;
+			}
+			Root->GetChildren()->Add(Element);
+		}
+
+		if (Root->GetChildren()->Count() == 0)
+			break;
+
+		Noesis::Ptr<Noesis::IView> View = Noesis::GUI::CreateView(Root);
+		View->SetSize(GlyphsViewSize, GlyphsViewSize);
+		View->Update(0.0);
+
+		// Desired sizes are clipped to the view, the actual height of the TextBlocks isn't
+		for (int32 Index = 0; Index != Root->GetChildren()->Count(); ++Index)
+		{
+			Noesis::Panel* Panel = Noesis::DynamicCast<Noesis::Panel*>(Root->GetChildren()->Get(Index));
+			for (int32 Child = 0; Panel && Child != Panel->GetChildren()->Count(); ++Child)
+			{
+				Noesis::FrameworkElement* TextBlock = Noesis::DynamicCast<Noesis::FrameworkElement*>(Panel->GetChildren()->Get(Child));
+				if (TextBlock && TextBlock->GetActualHeight() > (float)GlyphsViewSize)
+				{
+					UE_LOG(LogNoesis, Warning, TEXT("Glyphs of %s don't fit the prewarm view, some won't be rasterized"), *GetPathName());
+				}
+			}
+		}
+
+		RenderGlyphsView(View);
+	}
+}
+
 #if WITH_EDITORONLY_DATA
 void UNoesisXaml::PostInitProperties()
 {
@@ -38,6 +506,266 @@ void UNoesisXaml::PostInitProperties()
 	Super::PostInitProperties();
 }
 
+void UNoesisXaml::UpdateTextureSizes()
+{
+	TextureSizes.Reset(Textures.Num());
+	for (auto& TextureRef : Textures)
+	{
+		UTexture2D* Texture = TextureRef.LoadSynchronous();
+		TextureSizes.Add(Texture ? FIntPoint(Texture->GetSizeX(), Texture->GetSizeY()) : FIntPoint::ZeroValue);
+	}
+}
+
+static bool IsSameFont(const FNoesisGlyphSet& A, const FNoesisGlyphSet& B)
+{
+	return A.FontFamily == B.FontFamily && A.FontWeight == B.FontWeight && A.FontStyle == B.FontStyle && A.FontSize == B.FontSize;
+}
+
+static void AddGlyphs(TArray<FNoesisGlyphSet>& GlyphSets, const FNoesisGlyphSet& Font, const FString& Characters)
+{
+	FNoesisGlyphSet* GlyphSet = GlyphSets.FindByPredicate([&Font](const FNoesisGlyphSet& Set) { return IsSameFont(Set, Font); });
+	if (GlyphSet == nullptr)
+	{
+		GlyphSet = &GlyphSets.Add_GetRef(Font);
+		GlyphSet->Characters.Reset();
+	}
+
+	int32 Unused;
+	for (TCHAR Character : Characters)
+	{
+		if (Character >= TEXT(' ') && !GlyphSet->Characters.FindChar(Character, Unused))
+		{
+			GlyphSet->Characters.AppendChar(Character);
+		}
+	}
+}
+
+static FString DecodeXmlText(const FString& Text)
+{
+	FString Decoded;
+	Decoded.Reserve(Text.Len());
+	for (int32 Index = 0; Index < Text.Len(); ++Index)
+	{
+		int32 End = Text[Index] == TEXT('&') ? Text.Find(TEXT(";"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index) : INDEX_NONE;
+		if (End == INDEX_NONE)
+		{
+			Decoded.AppendChar(Text[Index]);
+			continue;
+		}
+
+		static const TCHAR* Entities[][2] = { { TEXT("amp"), TEXT("&") }, { TEXT("lt"), TEXT("<") }, { TEXT("gt"), TEXT(">") },
+			{ TEXT("quot"), TEXT("\"") }, { TEXT("apos"), TEXT("'") } };
+		FString Entity = Text.Mid(Index + 1, End - Index - 1);
+		uint32 Character = 0;
+		for (const auto& NamedEntity : Entities)
+		{
+			if (Entity == NamedEntity[0])
+			{
+				Character = NamedEntity[1][0];
+			}
+		}
+		if (Entity.StartsWith(TEXT("#x")))
+		{
+			Character = FParse::HexNumber(*Entity.Mid(2));
+		}
+		else if (Entity.StartsWith(TEXT("#")))
+		{
+			Character = (uint32)FCString::Atoi(*Entity.Mid(1));
+		}
+
+		if (Character == 0 || Character > 0xFFFF)
+		{
+			Decoded.AppendChar(Text[Index]);
+			continue;
+		}
+		Decoded.AppendChar((TCHAR)Character);
+		Index = End;
+	}
+	return Decoded;
+}
+
+// Walks the elements of the XAML keeping track of the inherited font properties, and records the characters of
+// the text found in content and in text attributes. Text set through bindings or resources can't be known at this
+// point, so the configured set of bound characters is recorded in its place. Fonts set by styles are not seen
+static void ParseGlyphSets(const FString& Text, const FString& BoundCharacters, TArray<FNoesisGlyphSet>& OutGlyphSets)
+{
+	static const TCHAR* TextAttributes[] = { TEXT("Text"), TEXT("Content"), TEXT("Header"), TEXT("ToolTip"), TEXT("Title") };
+
+	auto IsSpace = [](TCHAR C) { return C == TEXT(' ') || C == TEXT('\t') || C == TEXT('\r') || C == TEXT('\n'); };
+	auto SkipPast = [&Text](int32 Pos, const TCHAR* Terminator)
+	{
+		int32 Found = Text.Find(Terminator, ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+		return Found == INDEX_NONE ? Text.Len() : Found + FCString::Strlen(Terminator);
+	};
+
+	TArray<FNoesisGlyphSet> Fonts;
+	Fonts.AddDefaulted();
+	int32 Pos = 0;
+	while (Pos < Text.Len())
+	{
+		if (Text[Pos] != TEXT('<'))
+		{
+			int32 ContentEnd = Text.Find(TEXT("<"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+			ContentEnd = ContentEnd == INDEX_NONE ? Text.Len() : ContentEnd;
+			FString Content = DecodeXmlText(Text.Mid(Pos, ContentEnd - Pos).TrimStartAndEnd());
+			if (!Content.IsEmpty())
+			{
+				AddGlyphs(OutGlyphSets, Fonts.Last(), Content);
+			}
+			Pos = ContentEnd;
+			continue;
+		}
+
+		if (Text.Mid(Pos, 4) == TEXT("<!--"))
+		{
+			Pos = SkipPast(Pos, TEXT("-->"));
+			continue;
+		}
+		if (Text.Mid(Pos, 9) == TEXT("<![CDATA["))
+		{
+			int32 CDataEnd = SkipPast(Pos, TEXT("]]>"));
+			AddGlyphs(OutGlyphSets, Fonts.Last(), Text.Mid(Pos + 9, FMath::Max(CDataEnd - Pos - 12, 0)));
+			Pos = CDataEnd;
+			continue;
+		}
+		if (Text.Mid(Pos, 2) == TEXT("<?") || Text.Mid(Pos, 2) == TEXT("<!"))
+		{
+			Pos = SkipPast(Pos, TEXT(">"));
+			continue;
+		}
+		if (Text.Mid(Pos, 2) == TEXT("</"))
+		{
+			Pos = SkipPast(Pos, TEXT(">"));
+			if (Fonts.Num() > 1)
+			{
+				Fonts.Pop(false);
+			}
+			continue;
+		}
+
+		FNoesisGlyphSet Font = Fonts.Last();
+		TArray<FString> Values;
+		bool IsEmpty = false;
+		++Pos;
+		while (Pos < Text.Len() && !IsSpace(Text[Pos]) && Text[Pos] != TEXT('>') && Text[Pos] != TEXT('/'))
+		{
+			++Pos;
+		}
+
+		while (Pos < Text.Len() && Text[Pos] != TEXT('>'))
+		{
+			if (IsSpace(Text[Pos]) || Text[Pos] == TEXT('/'))
+			{
+				IsEmpty = Text[Pos] == TEXT('/');
+				++Pos;
+				continue;
+			}
+
+			int32 NameStart = Pos;
+			while (Pos < Text.Len() && Text[Pos] != TEXT('=') && !IsSpace(Text[Pos]) && Text[Pos] != TEXT('>'))
+			{
+				++Pos;
+			}
+			FString Name = Text.Mid(NameStart, Pos - NameStart);
+			while (Pos < Text.Len() && (IsSpace(Text[Pos]) || Text[Pos] == TEXT('=')))
+			{
+				++Pos;
+			}
+			if (Pos == Text.Len() || (Text[Pos] != TEXT('"') && Text[Pos] != TEXT('\'')))
+			{
+				continue;
+			}
+			int32 ValueEnd = Text.Find(FString(1, &Text[Pos]), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos + 1);
+			ValueEnd = ValueEnd == INDEX_NONE ? Text.Len() : ValueEnd;
+			FString Value = DecodeXmlText(Text.Mid(Pos + 1, ValueEnd - Pos - 1));
+			Pos = ValueEnd + 1;
+
+			// Attached forms like TextElement.FontSize count as well
+			int32 DotIndex;
+			if (Name.FindLastChar(TEXT('.'), DotIndex))
+			{
+				Name = Name.RightChop(DotIndex + 1);
+			}
+
+			bool IsExtension = Value.StartsWith(TEXT("{")) && !Value.StartsWith(TEXT("{}"));
+			if (Value.StartsWith(TEXT("{}")))
+			{
+				Value = Value.RightChop(2);
+			}
+
+			if (Name == TEXT("FontFamily") || Name == TEXT("FontWeight") || Name == TEXT("FontStyle") || Name == TEXT("FontSize"))
+			{
+				if (IsExtension)
+				{
+					continue;
+				}
+
+				if (Name == TEXT("FontFamily"))
+				{
+					Font.FontFamily = Value;
+				}
+				else if (Name == TEXT("FontWeight"))
+				{
+					Font.FontWeight = Value;
+				}
+				else if (Name == TEXT("FontStyle"))
+				{
+					Font.FontStyle = Value;
+				}
+				else
+				{
+					Font.FontSize = FCString::Atof(*Value);
+				}
+			}
+			else
+			{
+				for (const TCHAR* TextAttribute : TextAttributes)
+				{
+					if (Name == TextAttribute)
+					{
+						Values.Add(IsExtension ? BoundCharacters : Value);
+					}
+				}
+			}
+		}
+		Pos = FMath::Min(Pos + 1, Text.Len());
+
+		for (const FString& Value : Values)
+		{
+			AddGlyphs(OutGlyphSets, Font, Value);
+		}
+		if (!IsEmpty)
+		{
+			Fonts.Add(Font);
+		}
+	}
+
+	for (FNoesisGlyphSet& GlyphSet : OutGlyphSets)
+	{
+		TArray<TCHAR> Characters(*GlyphSet.Characters, GlyphSet.Characters.Len());
+		Characters.Sort();
+		GlyphSet.Characters = FString(Characters.Num(), Characters.GetData());
+	}
+}
+
+void UNoesisXaml::UpdateGlyphSets()
+{
+	int32 Start = XamlText.Num() >= 3 && XamlText[0] == 0xEF && XamlText[1] == 0xBB && XamlText[2] == 0xBF ? 3 : 0;
+	FUTF8ToTCHAR Converter((const ANSICHAR*)XamlText.GetData() + Start, XamlText.Num() - Start);
+	FString Text(Converter.Length(), Converter.Get());
+
+	GlyphSets.Reset();
+	ParseGlyphSets(Text, GetDefault<UNoesisSettings>()->GlyphPrewarmBoundCharacters, GlyphSets);
+}
+
+void UNoesisXaml::PreSave(const ITargetPlatform* TargetPlatform)
+{
+	UpdateTextureSizes();
+	UpdateGlyphSets();
+
+	Super::PreSave(TargetPlatform);
+}
+
 void UNoesisXaml::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
 {
 	if (AssetImportData)
@@ -49,6 +777,206 @@ void UNoesisXaml::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
 }
 #endif // WITH_EDITORONLY_DATA
 
+#if WITH_EDITOR
+// Removes comments and collapses the whitespace runs of a XAML document into single spaces, which is how XAML
+// treats them anyway unless xml:space is used. Returns false if the markup is not well formed
+static bool CompactXaml(const TArray<uint8>& Source, TArray<uint8>& Compacted)
+{
+	const uint8* Begin = Source.GetData();
+	const uint8* End = Begin + Source.Num();
+	const uint8* It = Begin;
+
+	auto IsSpace = [](uint8 C) { return C == ' ' || C == '\t' || C == '\r' || C == '\n'; };
+	auto StartsWith = [&It, End](const char* Prefix)
+	{
+		int32 Length = FCStringAnsi::Strlen(Prefix);
+		return End - It >= Length && FMemory::Memcmp(It, Prefix, Length) == 0;
+	};
+	auto Find = [&It, End](const char* Terminator) -> const uint8*
+	{
+		int32 Length = FCStringAnsi::Strlen(Terminator);
+		for (const uint8* Pos = It; End - Pos >= Length; ++Pos)
+		{
+			if (FMemory::Memcmp(Pos, Terminator, Length) == 0)
+			{
+				return Pos + Length;
+			}
+		}
+		return nullptr;
+	};
+
+	Compacted.Reset(Source.Num());
+	if (Find("xml:space") != nullptr)
+	{
+		Compacted.Append(Source);
+		return true;
+	}
+
+	TArray<TPair<const uint8*, int32>> OpenElements;
+	bool HasRoot = false;
+	while (It != End)
+	{
+		if (*It != '<')
+		{
+			if (IsSpace(*It))
+			{
+				while (It != End && IsSpace(*It))
+				{
+					++It;
+				}
+				if (OpenElements.Num() != 0 && Compacted.Last() != ' ')
+				{
+					Compacted.Add(' ');
+				}
+			}
+			else
+			{
+				Compacted.Add(*It++);
+			}
+			continue;
+		}
+
+		if (StartsWith("<!--"))
+		{
+			const uint8* CommentEnd = Find("-->");
+			if (CommentEnd == nullptr)
+			{
+				return false;
+			}
+			It = CommentEnd;
+			continue;
+		}
+
+		// CDATA sections, processing instructions and declarations are kept verbatim
+		const char* Terminator = StartsWith("<![CDATA[") ? "]]>" : StartsWith("<?") ? "?>" : StartsWith("<!") ? ">" : nullptr;
+		if (Terminator != nullptr)
+		{
+			const uint8* VerbatimEnd = Find(Terminator);
+			if (VerbatimEnd == nullptr)
+			{
+				return false;
+			}
+			Compacted.Append(It, VerbatimEnd - It);
+			It = VerbatimEnd;
+			continue;
+		}
+
+		Compacted.Add(*It++);
+		bool IsClosing = It != End && *It == '/';
+		if (IsClosing)
+		{
+			Compacted.Add(*It++);
+		}
+
+		const uint8* Name = It;
+		while (It != End && !IsSpace(*It) && *It != '>' && *It != '/')
+		{
+			Compacted.Add(*It++);
+		}
+		int32 NameLength = It - Name;
+		if (NameLength == 0)
+		{
+			return false;
+		}
+
+		bool IsEmpty = false;
+		bool IsTerminated = false;
+		bool PendingSpace = false;
+		while (It != End && !IsTerminated)
+		{
+			uint8 C = *It;
+			if (IsSpace(C))
+			{
+				PendingSpace = true;
+				++It;
+				continue;
+			}
+
+			if (PendingSpace && C != '/' && C != '>')
+			{
+				Compacted.Add(' ');
+			}
+			PendingSpace = false;
+
+			if (C == '"' || C == '\'')
+			{
+				const uint8* Value = It;
+				do
+				{
+					++It;
+				} while (It != End && *It != C);
+				if (It == End)
+				{
+					return false;
+				}
+				++It;
+				Compacted.Append(Value, It - Value);
+				continue;
+			}
+
+			IsEmpty = C == '/' || (IsEmpty && C == '>');
+			IsTerminated = C == '>';
+			Compacted.Add(*It++);
+		}
+
+		if (!IsTerminated)
+		{
+			return false;
+		}
+
+		if (IsClosing)
+		{
+			if (OpenElements.Num() == 0)
+			{
+				return false;
+			}
+			TPair<const uint8*, int32> Element = OpenElements.Pop(false);
+			if (Element.Value != NameLength || FMemory::Memcmp(Element.Key, Name, NameLength) != 0)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			if (OpenElements.Num() == 0 && HasRoot)
+			{
+				return false;
+			}
+			if (!IsEmpty)
+			{
+				OpenElements.Emplace(Name, NameLength);
+			}
+			HasRoot = true;
+		}
+	}
+
+	return HasRoot && OpenElements.Num() == 0;
+}
+#endif
+
+void UNoesisXaml::Serialize(FArchive& Ar)
+{
+#if WITH_EDITOR
+	// Cooked packages get the compacted text, so there is less to load and tokenize at runtime
+	if (Ar.IsSaving() && Ar.IsCooking() && !HasAnyFlags(RF_ClassDefaultObject))
+	{
+		TArray<uint8> CompactedText;
+		if (CompactXaml(XamlText, CompactedText))
+		{
+			UE_LOG(LogNoesis, Verbose, TEXT("Cooking %s: XAML compacted from %d to %d bytes"), *GetPathName(), XamlText.Num(), CompactedText.Num());
+			Swap(XamlText, CompactedText);
+			Super::Serialize(Ar);
+			Swap(XamlText, CompactedText);
+			return;
+		}
+
+		UE_LOG(LogNoesis, Warning, TEXT("Cooking %s: XAML is not well formed, cooking it unmodified"), *GetPathName());
+	}
+#endif
+
+	Super::Serialize(Ar);
+}
+
 void UNoesisXaml::PostLoad()
 {
 	Super::PostLoad();
@@ -58,6 +986,45 @@ void UNoesisXaml::PostLoad()
 	{
 		NoesisRuntime.RegisterFont(Font);
 	}
+
+	// Assets saved before the sizes were recorded are measured by loading their textures when first used, until
+	// they are resaved with the NoesisResaveXamls commandlet
+	RegisterTextureSizes();
+}
+
+void UNoesisXaml::BeginDestroy()
+{
+	UnregisterTextureSizes();
+
+	Super::BeginDestroy();
+}
+
+void UNoesisXaml::RegisterTextureSizes()
+{
+	UnregisterTextureSizes();
+
+	INoesisRuntimeModuleInterface& NoesisRuntime = INoesisRuntimeModuleInterface::Get();
+	for (int32 Index = 0; Index < Textures.Num() && Index < TextureSizes.Num(); ++Index)
+	{
+		if (!Textures[Index].IsNull())
+		{
+			NoesisRuntime.RegisterTextureSize(Textures[Index].ToSoftObjectPath(), TextureSizes[Index]);
+			RegisteredTextureSizes.Add(Textures[Index].ToSoftObjectPath());
+		}
+	}
+}
+
+void UNoesisXaml::UnregisterTextureSizes()
+{
+	if (RegisteredTextureSizes.Num() != 0 && INoesisRuntimeModuleInterface::IsAvailable())
+	{
+		INoesisRuntimeModuleInterface& NoesisRuntime = INoesisRuntimeModuleInterface::Get();
+		for (const FSoftObjectPath& TexturePath : RegisteredTextureSizes)
+		{
+			NoesisRuntime.UnregisterTextureSize(TexturePath);
+		}
+	}
+	RegisteredTextureSizes.Reset();
 }
 
 #if WITH_EDITOR
@@ -79,9 +1046,10 @@ void UNoesisXaml::PreloadDependencies()
 		}
 	}
 
-	for (auto Texture : Textures)
+	for (auto& TextureRef : Textures)
 	{
-		auto Linker = Texture->GetLinker();
+		UTexture2D* Texture = TextureRef.LoadSynchronous();
+		auto Linker = Texture ? Texture->GetLinker() : nullptr;
 		if (Linker)
 		{
 			Linker->Preload(Texture);
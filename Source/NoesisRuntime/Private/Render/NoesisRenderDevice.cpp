@@ -5,6 +5,10 @@
 
 #include "NoesisRenderDevice.h"
 
+// Core includes
+#include "Containers/Ticker.h"
+#include "Templates/Atomic.h"
+
 // Engine includes
 #include "Engine/Texture2D.h"
 #include "Engine/TextureRenderTarget2D.h"
@@ -16,26 +20,47 @@
 
 // NoesisRuntime includes
 #include "Render/NoesisShaders.h"
+#include "NoesisRuntimeModule.h"
 #include "NoesisSettings.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisVertexBytes"), STAT_NoesisVertexBytes, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisIndexBytes"), STAT_NoesisIndexBytes, STATGROUP_Noesis);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NoesisVertexBytesHighWater"), STAT_NoesisVertexBytesHighWater, STATGROUP_Noesis);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NoesisIndexBytesHighWater"), STAT_NoesisIndexBytesHighWater, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisPipelineStateCacheHits"), STAT_NoesisPipelineStateCacheHits, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisPipelineStateCacheMisses"), STAT_NoesisPipelineStateCacheMisses, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisPipelineStateSkipped"), STAT_NoesisPipelineStateSkipped, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisShaderConstantBytes"), STAT_NoesisShaderConstantBytes, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisShaderConstantBytesSkipped"), STAT_NoesisShaderConstantBytesSkipped, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisTextureUpdates"), STAT_NoesisTextureUpdates, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisTextureUploads"), STAT_NoesisTextureUploads, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisTextureUploadBytes"), STAT_NoesisTextureUploadBytes, STATGROUP_Noesis);
+DECLARE_MEMORY_STAT(TEXT("NoesisTextureStagingMemory"), STAT_NoesisTextureStagingMemory, STATGROUP_Noesis);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NoesisStreamedTextures"), STAT_NoesisStreamedTextures, STATGROUP_Noesis);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NoesisStreamedTexturesResident"), STAT_NoesisStreamedTexturesResident, STATGROUP_Noesis);
+
 class FNoesisTexture : public Noesis::Texture
 {
 public:
+	FNoesisTexture()
+		: Format(Noesis::TextureFormat::RGBA8), IsStaged(false), StreamedSizeX(0), StreamedSizeY(0), StreamedNumMips(0), LastDrawFrame(0), LastStreamingFrame(0)
+	{
+	}
 
 	// Texture interface
 	virtual uint32 GetWidth() const override
 	{
-		return (uint32)ShaderResourceTexture->GetSizeX();
+		return TextureReference ? StreamedSizeX : (uint32)ShaderResourceTexture->GetSizeX();
 	}
 
 	virtual uint32 GetHeight() const override
 	{
-		return (uint32)ShaderResourceTexture->GetSizeY();
+		return TextureReference ? StreamedSizeY : (uint32)ShaderResourceTexture->GetSizeY();
 	}
 
 	virtual bool HasMipMaps() const override
 	{
-		return (bool)(ShaderResourceTexture->GetNumMips() > 1);
+		return TextureReference ? StreamedNumMips > 1 : (bool)(ShaderResourceTexture->GetNumMips() > 1);
 	}
 
 	virtual bool IsInverted() const override
@@ -44,10 +69,90 @@ public:
 	}
 	// End of Texture interface
 
+	// Streamed textures get a new RHI texture every time mips are streamed in or out, so they are bound
+	// through the texture reference, which always points to the current one
+	FRHITexture* GetShaderResource()
+	{
+		if (TextureReference)
+		{
+			LastDrawFrame.Store(GFrameNumberRenderThread, EMemoryOrder::Relaxed);
+			return TextureReference->GetReferencedTexture();
+		}
+		return ShaderResourceTexture;
+	}
+
 	FTexture2DRHIRef ShaderResourceTexture;
 	Noesis::TextureFormat::Enum Format;
+
+	// Partial updates waiting for the next flush, only the bytes of the updated regions are kept. An update
+	// that continues the previous one, the next glyph on a row or the next rows, is merged into it so they are
+	// uploaded together. Updates are uploaded in order, so later ones overwrite earlier ones where they overlap
+	struct FStagedRegion
+	{
+		FIntRect Rect;
+		TArray<uint8> Data;
+	};
+
+	struct FStagingMip
+	{
+		static const int32 MaxRegions = 16;
+
+		TArray<FStagedRegion> Regions;
+	};
+	TArray<FStagingMip> StagingMips;
+	bool IsStaged;
+
+	FTextureReferenceRHIRef TextureReference;
+	TWeakObjectPtr<UTexture2D> StreamedTexture;
+	uint32 StreamedSizeX;
+	uint32 StreamedSizeY;
+	uint32 StreamedNumMips;
+	// Written by the render thread when drawn, read by the game thread in TickTextureStreaming
+	TAtomic<uint32> LastDrawFrame;
+	uint32 LastStreamingFrame;
 };
 
+// UI images aren't seen by the texture streamer, which leaves streamable textures at their lowest mips.
+// Textures drawn since the previous tick have their mips forced resident for a while, the streamer is free
+// to drop them again once the images stop being drawn. The list keeps a reference to the textures, they are
+// released on the game thread once nothing else uses them
+static const float TextureStreamingTickInterval = 1.0f;
+static const float TextureStreamingResidency = 3.0f;
+static FCriticalSection StreamedTexturesLock;
+static TArray<Noesis::Ptr<FNoesisTexture> > StreamedTextures;
+static FDelegateHandle TextureStreamingTickerHandle;
+
+static bool TickTextureStreaming(float DeltaTime)
+{
+	check(IsInGameThread());
+	FScopeLock Lock(&StreamedTexturesLock);
+	uint32 NumResident = 0;
+	for (int32 Index = StreamedTextures.Num(); Index-- > 0;)
+	{
+		FNoesisTexture* Texture = StreamedTextures[Index].GetPtr();
+		if (Texture->GetNumReferences() == 1)
+		{
+			StreamedTextures.RemoveAtSwap(Index);
+			continue;
+		}
+
+		uint32 LastDrawFrame = Texture->LastDrawFrame.Load(EMemoryOrder::Relaxed);
+		if (LastDrawFrame != Texture->LastStreamingFrame)
+		{
+			Texture->LastStreamingFrame = LastDrawFrame;
+			UTexture2D* Texture2D = Texture->StreamedTexture.Get();
+			if (Texture2D)
+			{
+				Texture2D->SetForceMipLevelsToBeResident(TextureStreamingResidency);
+				++NumResident;
+			}
+		}
+	}
+	SET_DWORD_STAT(STAT_NoesisStreamedTextures, StreamedTextures.Num());
+	SET_DWORD_STAT(STAT_NoesisStreamedTexturesResident, NumResident);
+	return true;
+}
+
 class FNoesisRenderTarget : public Noesis::RenderTarget
 {
 public:
@@ -67,11 +172,14 @@ public:
 uint32 FNoesisRenderDevice::RHICmdListTlsSlot;
 
 FNoesisRenderDevice::FNoesisRenderDevice()
-	: VertexBufferOffset(0), IndexBufferOffset(0), CurrentRenderTarget(0)
+	: StatsFrameNumber(0), FrameVertexBytes(0), FrameIndexBytes(0), PeakVertexBytes(0), PeakIndexBytes(0),
+	CurrentPipelineStateKey(InvalidPipelineStateKey), RenderTargetStateValid(false), TextureStagingBytes(0), CurrentRenderTarget(0)
 {
 	FRHIResourceCreateInfo CreateInfo;
-	DynamicVertexBuffer = RHICreateVertexBuffer(VertexBufferSize, BUF_Dynamic, CreateInfo);
-	DynamicIndexBuffer = RHICreateIndexBuffer(sizeof(int16), IndexBufferSize, BUF_Dynamic, CreateInfo);
+	// Volatile buffers get fresh memory from the RHI's per-frame allocator every time they are locked, so
+	// a batch never waits for the GPU to be done with the previous ones
+	DynamicVertexBuffer = RHICreateVertexBuffer(VertexBufferSize, BUF_Volatile, CreateInfo);
+	DynamicIndexBuffer = RHICreateIndexBuffer(sizeof(int16), IndexBufferSize, BUF_Volatile, CreateInfo);
 
 	const auto FeatureLevel = GMaxRHIFeatureLevel;
 	auto ShaderMap = GetGlobalShaderMap(FeatureLevel);
@@ -292,6 +400,7 @@ FNoesisRenderDevice::FNoesisRenderDevice()
 
 FNoesisRenderDevice::~FNoesisRenderDevice()
 {
+	RenderTargetPool.ReleaseAll();
 }
 
 uint32 GlyphCacheWidth[] = { 256, 512, 1024, 2048, 4096 };
@@ -310,6 +419,7 @@ FNoesisRenderDevice* FNoesisRenderDevice::Get()
 		NoesisRenderDevice->SetOffscreenMaxNumSurfaces((uint32)FMath::Max(0, GetDefault<UNoesisSettings>()->OffscreenMaxSurfaces));
 		NoesisRenderDevice->SetGlyphCacheWidth(GlyphCacheWidth[(uint8)GetDefault<UNoesisSettings>()->GlyphTextureSize]);
 		NoesisRenderDevice->SetGlyphCacheHeight(GlyphCacheHeight[(uint8)GetDefault<UNoesisSettings>()->GlyphTextureSize]);
+		NoesisRenderDevice->RenderTargetPool.SetBudget((uint64)FMath::Max(0, GetDefault<UNoesisSettings>()->RenderTargetPoolBudget) * 1024 * 1024);
 		RHICmdListTlsSlot = FPlatformTLS::AllocTlsSlot();
 	}
 	return NoesisRenderDevice;
@@ -321,6 +431,29 @@ void FNoesisRenderDevice::Destroy()
 	NoesisRenderDevice = nullptr;
 }
 
+void FNoesisRenderDevice::StartTextureStreaming()
+{
+	check(IsInGameThread());
+	if (!TextureStreamingTickerHandle.IsValid())
+	{
+		TextureStreamingTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickTextureStreaming), TextureStreamingTickInterval);
+	}
+}
+
+void FNoesisRenderDevice::StopTextureStreaming()
+{
+	check(IsInGameThread());
+	if (TextureStreamingTickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TextureStreamingTickerHandle);
+		TextureStreamingTickerHandle.Reset();
+	}
+
+	FScopeLock Lock(&StreamedTexturesLock);
+	StreamedTextures.Empty();
+	SET_DWORD_STAT(STAT_NoesisStreamedTextures, 0);
+}
+
 void FNoesisRenderDevice::ThreadLocal_SetRHICmdList(FRHICommandList* RHICmdList)
 {
 	FPlatformTLS::SetTlsValue(RHICmdListTlsSlot, RHICmdList);
@@ -346,6 +479,20 @@ Noesis::Ptr<Noesis::Texture> FNoesisRenderDevice::CreateTexture(UTexture* InText
 		}
 		Texture = new FNoesisTexture();
 		Texture->ShaderResourceTexture = TextureRef;
+
+		UTexture2D* Texture2D = (UTexture2D*)InTexture;
+		if (Texture2D->IsStreamable() && InTexture->TextureReference.TextureReferenceRHI && TextureStreamingTickerHandle.IsValid())
+		{
+			Texture->TextureReference = InTexture->TextureReference.TextureReferenceRHI;
+			Texture->StreamedTexture = Texture2D;
+			Texture->StreamedSizeX = (uint32)Texture2D->GetSizeX();
+			Texture->StreamedSizeY = (uint32)Texture2D->GetSizeY();
+			Texture->StreamedNumMips = (uint32)Texture2D->GetNumMips();
+
+			FScopeLock Lock(&StreamedTexturesLock);
+			StreamedTextures.Add(Noesis::Ptr<FNoesisTexture>(Texture));
+			SET_DWORD_STAT(STAT_NoesisStreamedTextures, StreamedTextures.Num());
+		}
 	}
 	else if (InTexture->IsA<UTextureRenderTarget2D>())
 	{
@@ -361,19 +508,56 @@ Noesis::Ptr<Noesis::Texture> FNoesisRenderDevice::CreateTexture(UTexture* InText
 	{
 		return nullptr;
 	}
-	switch (Texture->ShaderResourceTexture->GetFormat())
+	EPixelFormat PixelFormat = (EPixelFormat)Texture->ShaderResourceTexture->GetFormat();
+	if (!GetTextureFormat(PixelFormat, Texture->Format))
 	{
-	case PF_R8G8B8A8:
-		Texture->Format = Noesis::TextureFormat::RGBA8;
-		break;
-	case PF_G8:
-		Texture->Format = Noesis::TextureFormat::R8;
-		break;
+		UE_LOG(LogNoesis, Verbose, TEXT("Texture %s uses pixel format %s, sampling it as RGBA"), *InTexture->GetPathName(), GPixelFormats[PixelFormat].Name);
+	}
+
+	// The format is all that is needed from the texture currently resident. Holding on to it would keep
+	// the mips streamed out alive
+	if (Texture->TextureReference)
+	{
+		Texture->ShaderResourceTexture.SafeRelease();
 	}
 
 	return Noesis::Ptr<Noesis::Texture>(*Texture);
 }
 
+bool FNoesisRenderDevice::GetTextureFormat(EPixelFormat PixelFormat, Noesis::TextureFormat::Enum& OutFormat)
+{
+	// Block compressed formats are decoded by the sampler, for the shaders they are just RGBA textures,
+	// or R8 ones for the single channel formats
+	switch (PixelFormat)
+	{
+	case PF_G8:
+	case PF_BC4:
+		OutFormat = Noesis::TextureFormat::R8;
+		return true;
+	case PF_R8G8B8A8:
+	case PF_B8G8R8A8:
+	case PF_DXT1:
+	case PF_DXT3:
+	case PF_DXT5:
+	case PF_BC5:
+	case PF_BC6H:
+	case PF_BC7:
+	case PF_ASTC_4x4:
+	case PF_ASTC_6x6:
+	case PF_ASTC_8x8:
+	case PF_ASTC_10x10:
+	case PF_ASTC_12x12:
+	case PF_ETC1:
+	case PF_ETC2_RGB:
+	case PF_ETC2_RGBA:
+		OutFormat = Noesis::TextureFormat::RGBA8;
+		return true;
+	default:
+		OutFormat = Noesis::TextureFormat::RGBA8;
+		return false;
+	}
+}
+
 const Noesis::DeviceCaps& FNoesisRenderDevice::GetCaps() const
 {
 	static Noesis::DeviceCaps Caps = { 0.f, false, false };
@@ -385,20 +569,12 @@ Noesis::Ptr<Noesis::RenderTarget> FNoesisRenderDevice::CreateRenderTarget(const
 	uint32 SizeX = (uint32)Width;
 	uint32 SizeY = (uint32)Height;
 	uint8 Format = (uint8)PF_R8G8B8A8;
-	uint32 NumMips = 1;
-	uint32 Flags = 0;
-	uint32 TargetableTextureFlags = (uint32)TexCreate_RenderTargetable;
-	bool bForceSeparateTargetAndShaderResource = true;
-	FRHIResourceCreateInfo CreateInfo;
+	uint32 NumSamples = (uint32)SampleCount;
 	FTexture2DRHIRef ColorTarget;
 	FTexture2DRHIRef ShaderResourceTexture;
-	uint32 NumSamples = (uint32)SampleCount;
-	RHICreateTargetableShaderResource2D(SizeX, SizeY, Format, NumMips, Flags, TargetableTextureFlags, bForceSeparateTargetAndShaderResource, CreateInfo, ColorTarget, ShaderResourceTexture, NumSamples);
+	RenderTargetPool.FindFreeRenderTarget(SizeX, SizeY, Format, NumSamples, ColorTarget, ShaderResourceTexture);
 
-	Format = (uint8)PF_DepthStencil;
-	TargetableTextureFlags = (uint32)TexCreate_DepthStencilTargetable;
-	CreateInfo.ClearValueBinding = FClearValueBinding(0.f, 0);
-	FTexture2DRHIRef DepthStencilTarget = RHICreateTexture2D(SizeX, SizeY, Format, NumMips, NumSamples, TargetableTextureFlags, CreateInfo);
+	FTexture2DRHIRef DepthStencilTarget = RenderTargetPool.FindFreeDepthStencil(SizeX, SizeY, NumSamples);
 
 	FNoesisRenderTarget* RenderTarget = new FNoesisRenderTarget();
 	RenderTarget->Texture = *new FNoesisTexture();
@@ -460,8 +636,8 @@ Noesis::Ptr<Noesis::Texture> FNoesisRenderDevice::CreateTexture(const char* Labe
 		for (uint32 Level = 0; Level < NumMips; ++Level)
 		{
 			UpdateTexture(Texture, Level, 0, 0, Width, Height, Data[Level]);
-			Width >>= 1;
-			Height >>= 1;
+			Width = FMath::Max(Width >> 1, 1u);
+			Height = FMath::Max(Height >> 1, 1u);
 		}
 	}
 
@@ -471,6 +647,76 @@ Noesis::Ptr<Noesis::Texture> FNoesisRenderDevice::CreateTexture(const char* Labe
 void FNoesisRenderDevice::UpdateTexture(Noesis::Texture* InTexture, uint32 Level, uint32 X, uint32 Y, uint32 Width, uint32 Height, const void* Data)
 {
 	FNoesisTexture* Texture = (FNoesisTexture*)InTexture;
+	INC_DWORD_STAT(STAT_NoesisTextureUpdates);
+
+	const FPixelFormatInfo& FormatInfo = GPixelFormats[Texture->ShaderResourceTexture->GetFormat()];
+	uint32 MipSizeX = FMath::Max(Texture->ShaderResourceTexture->GetSizeX() >> Level, 1u);
+	uint32 MipSizeY = FMath::Max(Texture->ShaderResourceTexture->GetSizeY() >> Level, 1u);
+	bool IsWholeMip = X == 0 && Y == 0 && Width == MipSizeX && Height == MipSizeY;
+	bool IsBlockFormat = FormatInfo.BlockSizeX != 1 || FormatInfo.BlockSizeY != 1;
+	if (Texture->StagingMips.Num() <= (int32)Level)
+	{
+		Texture->StagingMips.SetNum(Level + 1);
+	}
+
+	if (Width == 0 || Height == 0)
+	{
+		return;
+	}
+
+	if (!IsWholeMip && !IsBlockFormat)
+	{
+		FNoesisTexture::FStagingMip& Mip = Texture->StagingMips[Level];
+		uint32 RowBytes = Width * FormatInfo.BlockBytes;
+		const uint8* SourceData = (const uint8*)Data;
+		FIntRect Rect(X, Y, X + Width, Y + Height);
+
+		FNoesisTexture::FStagedRegion* Previous = Mip.Regions.Num() != 0 ? &Mip.Regions.Last() : nullptr;
+		if (Previous && Previous->Rect.Min.X == Rect.Min.X && Previous->Rect.Max.X == Rect.Max.X && Previous->Rect.Max.Y == Rect.Min.Y)
+		{
+			Previous->Data.Append(SourceData, RowBytes * Height);
+			Previous->Rect.Max.Y = Rect.Max.Y;
+		}
+		else if (Previous && Previous->Rect.Min.Y == Rect.Min.Y && Previous->Rect.Max.Y == Rect.Max.Y && Previous->Rect.Max.X == Rect.Min.X)
+		{
+			uint32 PreviousRowBytes = Previous->Rect.Width() * FormatInfo.BlockBytes;
+			TArray<uint8> Merged;
+			Merged.SetNumUninitialized((PreviousRowBytes + RowBytes) * Height);
+			uint8* DestRow = Merged.GetData();
+			for (uint32 Row = 0; Row != Height; ++Row)
+			{
+				FMemory::Memcpy(DestRow, Previous->Data.GetData() + Row * PreviousRowBytes, PreviousRowBytes);
+				FMemory::Memcpy(DestRow + PreviousRowBytes, SourceData + Row * RowBytes, RowBytes);
+				DestRow += PreviousRowBytes + RowBytes;
+			}
+			Previous->Data = MoveTemp(Merged);
+			Previous->Rect.Max.X = Rect.Max.X;
+		}
+		else
+		{
+			if (Mip.Regions.Num() == FNoesisTexture::FStagingMip::MaxRegions)
+			{
+				UploadStagedRegions(Texture, (int32)Level);
+			}
+
+			FNoesisTexture::FStagedRegion& Region = Mip.Regions.AddDefaulted_GetRef();
+			Region.Rect = Rect;
+			Region.Data.Append(SourceData, RowBytes * Height);
+		}
+
+		TextureStagingBytes += RowBytes * Height;
+		INC_MEMORY_STAT_BY(STAT_NoesisTextureStagingMemory, RowBytes * Height);
+
+		if (!Texture->IsStaged)
+		{
+			Texture->IsStaged = true;
+			StagedTextures.Add(Noesis::Ptr<Noesis::Texture>(Texture));
+		}
+		return;
+	}
+
+	// The whole mip is written, the updates still waiting for it would be overwritten
+	DiscardStagedRegions(Texture, (int32)Level);
 
 	int32 MipIndex = (int32)Level;
 	FUpdateTextureRegion2D UpdateRegion;
@@ -480,14 +726,65 @@ void FNoesisRenderDevice::UpdateTexture(Noesis::Texture* InTexture, uint32 Level
 	UpdateRegion.DestY = (uint32)Y;
 	UpdateRegion.Width = (uint32)Width;
 	UpdateRegion.Height = (uint32)Height;
-	uint32 SourcePitch = (uint32)Width * ((Texture->ShaderResourceTexture->GetFormat() == PF_R8G8B8A8) ? 4 : 1);
+	// Rows of blocks for block compressed formats, each one covering BlockSizeY rows of texels
+	uint32 SourcePitch = FMath::DivideAndRoundUp((uint32)Width, (uint32)FormatInfo.BlockSizeX) * (uint32)FormatInfo.BlockBytes;
 	const uint8* SourceData = (const uint8*)Data;
 
 	RHIUpdateTexture2D(Texture->ShaderResourceTexture, MipIndex, UpdateRegion, SourcePitch, SourceData);
+	INC_DWORD_STAT(STAT_NoesisTextureUploads);
+	INC_DWORD_STAT_BY(STAT_NoesisTextureUploadBytes, SourcePitch * FMath::DivideAndRoundUp((uint32)Height, (uint32)FormatInfo.BlockSizeY));
+}
+
+void FNoesisRenderDevice::UploadStagedRegions(FNoesisTexture* Texture, int32 Level)
+{
+	uint32 BytesPerPixel = GPixelFormats[Texture->ShaderResourceTexture->GetFormat()].BlockBytes;
+	FNoesisTexture::FStagingMip& Mip = Texture->StagingMips[Level];
+	for (const FNoesisTexture::FStagedRegion& Region : Mip.Regions)
+	{
+		FUpdateTextureRegion2D UpdateRegion;
+		UpdateRegion.SrcX = 0;
+		UpdateRegion.SrcY = 0;
+		UpdateRegion.DestX = (uint32)Region.Rect.Min.X;
+		UpdateRegion.DestY = (uint32)Region.Rect.Min.Y;
+		UpdateRegion.Width = (uint32)Region.Rect.Width();
+		UpdateRegion.Height = (uint32)Region.Rect.Height();
+
+		RHIUpdateTexture2D(Texture->ShaderResourceTexture, Level, UpdateRegion, UpdateRegion.Width * BytesPerPixel, Region.Data.GetData());
+		INC_DWORD_STAT(STAT_NoesisTextureUploads);
+		INC_DWORD_STAT_BY(STAT_NoesisTextureUploadBytes, Region.Data.Num());
+	}
+	DiscardStagedRegions(Texture, Level);
+}
+
+void FNoesisRenderDevice::DiscardStagedRegions(FNoesisTexture* Texture, int32 Level)
+{
+	FNoesisTexture::FStagingMip& Mip = Texture->StagingMips[Level];
+	for (const FNoesisTexture::FStagedRegion& Region : Mip.Regions)
+	{
+		TextureStagingBytes -= Region.Data.Num();
+		DEC_MEMORY_STAT_BY(STAT_NoesisTextureStagingMemory, Region.Data.Num());
+	}
+	Mip.Regions.Empty();
+}
+
+void FNoesisRenderDevice::FlushTextureUploads()
+{
+	for (auto& StagedTexture : StagedTextures)
+	{
+		FNoesisTexture* Texture = (FNoesisTexture*)StagedTexture.GetPtr();
+		for (int32 Level = 0; Level != Texture->StagingMips.Num(); ++Level)
+		{
+			UploadStagedRegions(Texture, Level);
+		}
+		Texture->IsStaged = false;
+	}
+	StagedTextures.Reset();
 }
 
 void FNoesisRenderDevice::BeginRender(bool Offscreen)
 {
+	FlushTextureUploads();
+	InvalidatePipelineState();
 }
 
 void FNoesisRenderDevice::SetRenderTarget(Noesis::RenderTarget* Surface)
@@ -503,6 +800,7 @@ void FNoesisRenderDevice::SetRenderTarget(Noesis::RenderTarget* Surface)
 	RHICmdList->BeginRenderPass(RPInfo, TEXT("NoesisOffScreen"));
 	RHICmdList->SetViewport(0, 0, 0.0f, RenderTarget->ColorTarget->GetSizeX(), RenderTarget->ColorTarget->GetSizeY(), 1.0f);
 	CurrentRenderTarget = RenderTarget;
+	InvalidatePipelineState();
 }
 
 void FNoesisRenderDevice::BeginTile(const Noesis::Tile& Tile, uint32 SurfaceWidth, uint32 SurfaceHeight)
@@ -552,14 +850,34 @@ void FNoesisRenderDevice::ResolveRenderTarget(Noesis::RenderTarget* Surface, con
 
 	check(RHICmdList->IsInsideRenderPass());
 	RHICmdList->EndRenderPass();
+	InvalidatePipelineState();
 }
 
 void FNoesisRenderDevice::EndRender()
 {
+	InvalidatePipelineState();
+}
+
+void FNoesisRenderDevice::UpdateFrameStats()
+{
+	if (StatsFrameNumber != GFrameNumberRenderThread)
+	{
+		StatsFrameNumber = GFrameNumberRenderThread;
+		FrameVertexBytes = 0;
+		FrameIndexBytes = 0;
+	}
 }
 
 void* FNoesisRenderDevice::MapVertices(uint32 Bytes)
 {
+	check(Bytes <= VertexBufferSize);
+	UpdateFrameStats();
+
+	FrameVertexBytes += Bytes;
+	PeakVertexBytes = FMath::Max(PeakVertexBytes, FrameVertexBytes);
+	INC_DWORD_STAT_BY(STAT_NoesisVertexBytes, Bytes);
+	SET_DWORD_STAT(STAT_NoesisVertexBytesHighWater, PeakVertexBytes);
+
 	void* Result = RHILockVertexBuffer(DynamicVertexBuffer, 0, Bytes, RLM_WriteOnly);
 	return Result;
 }
@@ -571,6 +889,14 @@ void FNoesisRenderDevice::UnmapVertices()
 
 void* FNoesisRenderDevice::MapIndices(uint32 Bytes)
 {
+	check(Bytes <= IndexBufferSize);
+	UpdateFrameStats();
+
+	FrameIndexBytes += Bytes;
+	PeakIndexBytes = FMath::Max(PeakIndexBytes, FrameIndexBytes);
+	INC_DWORD_STAT_BY(STAT_NoesisIndexBytes, Bytes);
+	SET_DWORD_STAT(STAT_NoesisIndexBytesHighWater, PeakIndexBytes);
+
 	void* Result = RHILockIndexBuffer(DynamicIndexBuffer, 0, Bytes, RLM_WriteOnly);
 	return Result;
 }
@@ -633,14 +959,9 @@ static FRHISamplerState* GetSamplerState(uint32 SamplerCode)
 	return 0;
 }
 
-void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
+static void InitPipelineState(FGraphicsPipelineStateInitializer& GraphicsPSOInit, Noesis::RenderState RenderState)
 {
-	FRHICommandList* RHICmdList = ThreadLocal_GetRHICmdList();
-	check(RHICmdList);
-	FGraphicsPipelineStateInitializer GraphicsPSOInit;
-	RHICmdList->ApplyCachedRenderTargets(GraphicsPSOInit);
-
-	switch (Batch.renderState.f.stencilMode)
+	switch (RenderState.f.stencilMode)
 	{
 		case Noesis::StencilMode::Disabled:
 		{
@@ -663,9 +984,9 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 		} break;
 	}
 
-	if (Batch.renderState.f.colorEnable)
+	if (RenderState.f.colorEnable)
 	{
-		if (Batch.renderState.f.blendMode == Noesis::BlendMode::SrcOver)
+		if (RenderState.f.blendMode == Noesis::BlendMode::SrcOver)
 		{
 			GraphicsPSOInit.BlendState = TStaticBlendState<CW_RGBA, BO_Add, BF_One, BF_InverseSourceAlpha, BO_Add, BF_One, BF_InverseSourceAlpha>::GetRHI();
 		}
@@ -676,7 +997,7 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 	}
 	else
 	{
-		if (Batch.renderState.f.blendMode == Noesis::BlendMode::SrcOver)
+		if (RenderState.f.blendMode == Noesis::BlendMode::SrcOver)
 		{
 			GraphicsPSOInit.BlendState = TStaticBlendState<CW_NONE, BO_Add, BF_One, BF_InverseSourceAlpha, BO_Add, BF_One, BF_InverseSourceAlpha>::GetRHI();
 		}
@@ -686,14 +1007,119 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 		}
 	}
 
-	GraphicsPSOInit.RasterizerState = Batch.renderState.f.wireframe ? TStaticRasterizerState<FM_Wireframe, CM_None>::GetRHI() : TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
+	GraphicsPSOInit.RasterizerState = RenderState.f.wireframe ? TStaticRasterizerState<FM_Wireframe, CM_None>::GetRHI() : TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
+}
+
+void FNoesisRenderDevice::InvalidateShaderConstants()
+{
+	ProjectionMtxCache.Invalidate();
+	VSTextureSizeCache.Invalidate();
+	RgbaCache.Invalidate();
+	RadialGradCache.Invalidate();
+	OpacityCache.Invalidate();
+	PSTextureSizeCache.Invalidate();
+	EffectsParamsCache.Invalidate();
+}
+
+void FNoesisRenderDevice::InvalidatePipelineState()
+{
+	CurrentPipelineStateKey = InvalidPipelineStateKey;
+	RenderTargetStateValid = false;
+	InvalidateShaderConstants();
+}
+
+template<class T>
+static bool UpdateShaderConstant(T& Cache, const void* Value, uint32 Bytes)
+{
+	if (Cache.Update(Value, Bytes))
+	{
+		INC_DWORD_STAT_BY(STAT_NoesisShaderConstantBytes, Bytes);
+		return true;
+	}
+
+	INC_DWORD_STAT_BY(STAT_NoesisShaderConstantBytesSkipped, Bytes);
+	return false;
+}
+
+// The cached states only depend on the shader and render state, the render target part of the initializer is
+// taken from the render pass being drawn
+static void CopyRenderTargetState(FGraphicsPipelineStateInitializer& GraphicsPSOInit, const FGraphicsPipelineStateInitializer& RenderTargetState)
+{
+	GraphicsPSOInit.RenderTargetsEnabled = RenderTargetState.RenderTargetsEnabled;
+	GraphicsPSOInit.RenderTargetFormats = RenderTargetState.RenderTargetFormats;
+	GraphicsPSOInit.RenderTargetFlags = RenderTargetState.RenderTargetFlags;
+	GraphicsPSOInit.RenderTargetLoadActions = RenderTargetState.RenderTargetLoadActions;
+	GraphicsPSOInit.RenderTargetStoreActions = RenderTargetState.RenderTargetStoreActions;
+	GraphicsPSOInit.DepthStencilTargetFormat = RenderTargetState.DepthStencilTargetFormat;
+	GraphicsPSOInit.DepthStencilTargetFlag = RenderTargetState.DepthStencilTargetFlag;
+	GraphicsPSOInit.DepthTargetLoadAction = RenderTargetState.DepthTargetLoadAction;
+	GraphicsPSOInit.DepthTargetStoreAction = RenderTargetState.DepthTargetStoreAction;
+	GraphicsPSOInit.StencilTargetLoadAction = RenderTargetState.StencilTargetLoadAction;
+	GraphicsPSOInit.StencilTargetStoreAction = RenderTargetState.StencilTargetStoreAction;
+	GraphicsPSOInit.DepthStencilAccess = RenderTargetState.DepthStencilAccess;
+	GraphicsPSOInit.NumSamples = RenderTargetState.NumSamples;
+}
+
+void FNoesisRenderDevice::SetPipelineState(FRHICommandList& RHICmdList, const Noesis::Batch& Batch)
+{
+	if (!RenderTargetStateValid)
+	{
+		RenderTargetState = FGraphicsPipelineStateInitializer();
+		RHICmdList.ApplyCachedRenderTargets(RenderTargetState);
+		RenderTargetStateValid = true;
+	}
+
+	uint32 ShaderCode = (uint32)Batch.shader.v;
+	uint32 PipelineStateKey = ShaderCode | ((uint32)Batch.renderState.v << 8);
+
+	// Consecutive batches usually share the same state, there's no need to set it again
+	if (PipelineStateKey == CurrentPipelineStateKey)
+	{
+		INC_DWORD_STAT(STAT_NoesisPipelineStateSkipped);
+		return;
+	}
+
+	FGraphicsPipelineStateInitializer* GraphicsPSOInit = PipelineStates.Find(PipelineStateKey);
+	if (GraphicsPSOInit)
+	{
+		INC_DWORD_STAT(STAT_NoesisPipelineStateCacheHits);
+		CopyRenderTargetState(*GraphicsPSOInit, RenderTargetState);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_NoesisPipelineStateCacheMisses);
+		GraphicsPSOInit = &PipelineStates.Add(PipelineStateKey, RenderTargetState);
+		InitPipelineState(*GraphicsPSOInit, Batch.renderState);
+		GraphicsPSOInit->BoundShaderState.VertexDeclarationRHI = VertexDeclarations[ShaderCode];
+		GraphicsPSOInit->PrimitiveType = PT_TriangleList;
+	}
+
+	GraphicsPSOInit->BoundShaderState.VertexShaderRHI = RHICmdList.GetBoundVertexShader(); // GETSAFERHISHADER_VERTEX(VertexShader);
+	GraphicsPSOInit->BoundShaderState.PixelShaderRHI = RHICmdList.GetBoundPixelShader(); //  GETSAFERHISHADER_PIXEL(PixelShader);
+
+	SetGraphicsPipelineState(RHICmdList, *GraphicsPSOInit);
+	CurrentPipelineStateKey = PipelineStateKey;
+	InvalidateShaderConstants();
+}
+
+void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
+{
+	FRHICommandList* RHICmdList = ThreadLocal_GetRHICmdList();
+	check(RHICmdList);
+
+	if (StagedTextures.Num() != 0)
+	{
+		FlushTextureUploads();
+	}
+
+	SetPipelineState(*RHICmdList, Batch);
 
 	FRHITexture* PatternTexture = 0;
 	FRHISamplerState* PatternSamplerState = 0;
 	if (Batch.pattern)
 	{
 		FNoesisTexture* Texture = (FNoesisTexture*)(Batch.pattern);
-		PatternTexture = Texture->ShaderResourceTexture;
+		PatternTexture = Texture->GetShaderResource();
 		PatternSamplerState = GetSamplerState((uint32)*(uint8*)&Batch.patternSampler);
 	}
 
@@ -702,7 +1128,7 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 	if (Batch.ramps)
 	{
 		FNoesisTexture* Texture = (FNoesisTexture*)(Batch.ramps);
-		RampsTexture = Texture->ShaderResourceTexture;
+		RampsTexture = Texture->GetShaderResource();
 		RampsSamplerState = GetSamplerState((uint32)*(uint8*)&Batch.rampsSampler);
 	}
 
@@ -711,7 +1137,7 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 	if (Batch.image)
 	{
 		FNoesisTexture* Texture = (FNoesisTexture*)(Batch.image);
-		ImageTexture = Texture->ShaderResourceTexture;
+		ImageTexture = Texture->GetShaderResource();
 		ImageSamplerState = GetSamplerState((uint32)*(uint8*)&Batch.imageSampler);
 	}
 
@@ -720,7 +1146,7 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 	if (Batch.glyphs)
 	{
 		FNoesisTexture* Texture = (FNoesisTexture*)(Batch.glyphs);
-		GlyphsTexture = Texture->ShaderResourceTexture;
+		GlyphsTexture = Texture->GetShaderResource();
 		GlyphsSamplerState = GetSamplerState((uint32)*(uint8*)&Batch.glyphsSampler);
 	}
 
@@ -729,25 +1155,16 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 	if (Batch.shadow)
 	{
 		FNoesisTexture* Texture = (FNoesisTexture*)(Batch.shadow);
-		ShadowTexture = Texture->ShaderResourceTexture;
+		ShadowTexture = Texture->GetShaderResource();
 		ShadowSamplerState = GetSamplerState((uint32)*(uint8*)&Batch.shadowSampler);
 	}
 
-	const auto FeatureLevel = GMaxRHIFeatureLevel;
-
 	uint32 ShaderCode = (uint32)Batch.shader.v;
 
-	FVertexDeclarationRHIRef& VertexDeclaration = VertexDeclarations[ShaderCode];
 	FNoesisVSBase* VertexShader = VertexShaders[ShaderCode];
 	FNoesisPSBase* PixelShader = PixelShaders[ShaderCode];
-	GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = VertexDeclaration;
-	GraphicsPSOInit.BoundShaderState.VertexShaderRHI = RHICmdList->GetBoundVertexShader(); // GETSAFERHISHADER_VERTEX(VertexShader);
-	GraphicsPSOInit.BoundShaderState.PixelShaderRHI = RHICmdList->GetBoundPixelShader(); //  GETSAFERHISHADER_PIXEL(PixelShader);
-	GraphicsPSOInit.PrimitiveType = PT_TriangleList;
-
-	SetGraphicsPipelineState(*RHICmdList, GraphicsPSOInit);
 
-	float TextureSize[4];
+	float TextureSize[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 	if (Batch.glyphs || Batch.image)
 	{
 		FNoesisTexture* Texture = (FNoesisTexture*)(Batch.glyphs ? Batch.glyphs : Batch.image);
@@ -760,18 +1177,59 @@ void FNoesisRenderDevice::DrawBatch(const Noesis::Batch& Batch)
 	}
 	bool GenSt1 = ShaderCode >= Noesis::Shader::SDF_Solid && ShaderCode <= Noesis::Shader::SDF_LCD_Pattern;
 
-	FMatrix ProjectionMtxValue(FPlane((*Batch.projMtx)[0], (*Batch.projMtx)[4], (*Batch.projMtx)[8], (*Batch.projMtx)[12]),
-		FPlane((*Batch.projMtx)[1], (*Batch.projMtx)[5], (*Batch.projMtx)[9], (*Batch.projMtx)[13]),
-		FPlane((*Batch.projMtx)[2], (*Batch.projMtx)[6], (*Batch.projMtx)[10], (*Batch.projMtx)[14]),
-		FPlane((*Batch.projMtx)[3], (*Batch.projMtx)[7], (*Batch.projMtx)[11], (*Batch.projMtx)[15]));
-	VertexShader->SetParameters(*RHICmdList, ProjectionMtxValue, GenSt1 ? (float(*)[2])&TextureSize : nullptr);
+	const FMatrix* ProjectionMtxPtr = nullptr;
+	FMatrix ProjectionMtxValue;
+	if (UpdateShaderConstant(ProjectionMtxCache, *Batch.projMtx, 16 * sizeof(float)))
+	{
+		ProjectionMtxValue = FMatrix(FPlane((*Batch.projMtx)[0], (*Batch.projMtx)[4], (*Batch.projMtx)[8], (*Batch.projMtx)[12]),
+			FPlane((*Batch.projMtx)[1], (*Batch.projMtx)[5], (*Batch.projMtx)[9], (*Batch.projMtx)[13]),
+			FPlane((*Batch.projMtx)[2], (*Batch.projMtx)[6], (*Batch.projMtx)[10], (*Batch.projMtx)[14]),
+			FPlane((*Batch.projMtx)[3], (*Batch.projMtx)[7], (*Batch.projMtx)[11], (*Batch.projMtx)[15]));
+		ProjectionMtxPtr = &ProjectionMtxValue;
+	}
+	const float (*VSTextureSizePtr)[2] = nullptr;
+	if (GenSt1 && UpdateShaderConstant(VSTextureSizeCache, TextureSize, 2 * sizeof(float)))
+	{
+		VSTextureSizePtr = (float(*)[2])&TextureSize;
+	}
+	if (ProjectionMtxPtr || VSTextureSizePtr)
+	{
+		VertexShader->SetParameters(*RHICmdList, ProjectionMtxPtr, VSTextureSizePtr);
+	}
 
-	const FVector4* RgbaValue = (const FVector4*)Batch.rgba;
-	const FVector4 (*RadialGradValue)[2] = (const FVector4(*)[2])Batch.radialGrad;
-	const float* OpacityValue = Batch.opacity;
-	PixelShader->SetParameters(*RHICmdList, RgbaValue, RadialGradValue, OpacityValue);
+	const FVector4* RgbaValue = nullptr;
+	if (Batch.rgba && UpdateShaderConstant(RgbaCache, Batch.rgba, 4 * sizeof(float)))
+	{
+		RgbaValue = (const FVector4*)Batch.rgba;
+	}
+	const FVector4 (*RadialGradValue)[2] = nullptr;
+	if (Batch.radialGrad && UpdateShaderConstant(RadialGradCache, Batch.radialGrad, 8 * sizeof(float)))
+	{
+		RadialGradValue = (const FVector4(*)[2])Batch.radialGrad;
+	}
+	const float* OpacityValue = nullptr;
+	if (Batch.opacity && UpdateShaderConstant(OpacityCache, Batch.opacity, sizeof(float)))
+	{
+		OpacityValue = Batch.opacity;
+	}
+	if (RgbaValue || RadialGradValue || OpacityValue)
+	{
+		PixelShader->SetParameters(*RHICmdList, RgbaValue, RadialGradValue, OpacityValue);
+	}
 
-	PixelShader->SetEffectsParameters(*RHICmdList, &TextureSize, Batch.effectParams, Batch.effectParamsSize);
+	if (Batch.effectParamsSize)
+	{
+		bool TextureSizeChanged = UpdateShaderConstant(PSTextureSizeCache, TextureSize, 4 * sizeof(float));
+		bool EffectsParamsChanged = UpdateShaderConstant(EffectsParamsCache, Batch.effectParams, Batch.effectParamsSize * sizeof(float));
+		if (TextureSizeChanged || EffectsParamsChanged)
+		{
+			PixelShader->SetEffectsParameters(*RHICmdList, &TextureSize, Batch.effectParams, Batch.effectParamsSize);
+		}
+	}
+	else
+	{
+		PixelShader->SetEffectsParameters(*RHICmdList, &TextureSize, Batch.effectParams, Batch.effectParamsSize);
+	}
 
 	if (PatternTexture)
 	{
@@ -12,6 +12,10 @@
 // Noesis includes
 #include "NoesisSDK.h"
 
+// NoesisRuntime includes
+#include "Render/NoesisShaders.h"
+#include "Render/NoesisRenderTargetPool.h"
+
 class FNoesisRenderDevice : public Noesis::RenderDevice
 {
 	static const uint32 VertexBufferSize = 512 * 1024;
@@ -19,8 +23,45 @@ class FNoesisRenderDevice : public Noesis::RenderDevice
 
 	FVertexBufferRHIRef DynamicVertexBuffer;
 	FIndexBufferRHIRef DynamicIndexBuffer;
-	uint32 VertexBufferOffset;
-	uint32 IndexBufferOffset;
+
+	// Per-frame usage of the dynamic buffers, used to report the high-water marks.
+	uint32 StatsFrameNumber;
+	uint32 FrameVertexBytes;
+	uint32 FrameIndexBytes;
+	uint32 PeakVertexBytes;
+	uint32 PeakIndexBytes;
+
+	void UpdateFrameStats();
+
+	// Pipeline states already built, keyed by shader and render state. Their render target state is refreshed
+	// from the current render pass on every use.
+	static const uint32 InvalidPipelineStateKey = 0xffffffff;
+	TMap<uint32, FGraphicsPipelineStateInitializer> PipelineStates;
+	uint32 CurrentPipelineStateKey;
+	FGraphicsPipelineStateInitializer RenderTargetState;
+	bool RenderTargetStateValid;
+
+	// Constants last uploaded to the bound shaders.
+	TNoesisShaderConstantCache<16 * sizeof(float)> ProjectionMtxCache;
+	TNoesisShaderConstantCache<2 * sizeof(float)> VSTextureSizeCache;
+	TNoesisShaderConstantCache<4 * sizeof(float)> RgbaCache;
+	TNoesisShaderConstantCache<8 * sizeof(float)> RadialGradCache;
+	TNoesisShaderConstantCache<sizeof(float)> OpacityCache;
+	TNoesisShaderConstantCache<4 * sizeof(float)> PSTextureSizeCache;
+	TNoesisShaderConstantCache<32 * sizeof(float)> EffectsParamsCache;
+
+	void InvalidateShaderConstants();
+	void InvalidatePipelineState();
+	void SetPipelineState(class FRHICommandList& RHICmdList, const Noesis::Batch& Batch);
+
+	// Partial texture updates, mostly glyphs, are staged and uploaded when the next render pass begins, or
+	// before drawing if they arrive in the middle of one. Consecutive updates are uploaded as one region.
+	TArray<Noesis::Ptr<Noesis::Texture> > StagedTextures;
+	uint32 TextureStagingBytes;
+
+	void UploadStagedRegions(class FNoesisTexture* Texture, int32 Level);
+	void DiscardStagedRegions(class FNoesisTexture* Texture, int32 Level);
+	void FlushTextureUploads();
 
 	FNoesisRenderDevice();
 	virtual ~FNoesisRenderDevice();
@@ -33,10 +74,20 @@ public:
 
 	class FNoesisRenderTarget* CurrentRenderTarget;
 
+	FNoesisRenderTargetPool RenderTargetPool;
+
+	// Bytes of partial texture updates waiting to be uploaded
+	uint32 GetTextureStagingBytes() const { return TextureStagingBytes; }
+
 	static FNoesisRenderDevice* Get();
 	static void Destroy();
 
 	static Noesis::Ptr<Noesis::Texture> CreateTexture(class UTexture* Texture);
+	// Format the shaders sample a texture of the given pixel format as, false if it isn't a known one
+	static bool GetTextureFormat(EPixelFormat PixelFormat, Noesis::TextureFormat::Enum& OutFormat);
+
+	static void StartTextureStreaming();
+	static void StopTextureStreaming();
 
 	static void ThreadLocal_SetRHICmdList(class FRHICommandList* RHICmdList);
 	static class FRHICommandList* ThreadLocal_GetRHICmdList();
@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "NoesisRenderTargetPool.h"
+
+// RenderCore includes
+#include "RenderUtils.h"
+
+// NoesisRuntime includes
+#include "NoesisRuntimeModule.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NoesisRenderTargetPoolTextures"), STAT_NoesisRenderTargetPoolTextures, STATGROUP_Noesis);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NoesisRenderTargetPoolTexturesInUse"), STAT_NoesisRenderTargetPoolTexturesInUse, STATGROUP_Noesis);
+DECLARE_MEMORY_STAT(TEXT("NoesisRenderTargetPoolMemory"), STAT_NoesisRenderTargetPoolMemory, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisRenderTargetPoolAllocations"), STAT_NoesisRenderTargetPoolAllocations, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisRenderTargetPoolAllocationsAvoided"), STAT_NoesisRenderTargetPoolAllocationsAvoided, STATGROUP_Noesis);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NoesisRenderTargetPoolEvictions"), STAT_NoesisRenderTargetPoolEvictions, STATGROUP_Noesis);
+
+bool FNoesisRenderTargetPool::FPooledTexture::IsFree() const
+{
+	// The pool holds the only reference
+	return TargetableTexture->GetRefCount() == 1 && (!ShaderResourceTexture.IsValid() || ShaderResourceTexture->GetRefCount() == 1);
+}
+
+FNoesisRenderTargetPool::FNoesisRenderTargetPool()
+	: BudgetBytes(0), AllocatedBytes(0)
+{
+}
+
+void FNoesisRenderTargetPool::SetBudget(uint64 InBudgetBytes)
+{
+	BudgetBytes = InBudgetBytes;
+}
+
+FNoesisRenderTargetPool::FPooledTexture* FNoesisRenderTargetPool::FindFreeTexture(uint32 SizeX, uint32 SizeY, uint8 Format, uint32 NumSamples)
+{
+	check(IsInRenderingThread());
+
+	for (FPooledTexture& Texture : Textures)
+	{
+		if (Texture.SizeX == SizeX && Texture.SizeY == SizeY && Texture.Format == Format && Texture.NumSamples == NumSamples && Texture.IsFree())
+		{
+			return &Texture;
+		}
+	}
+
+	return nullptr;
+}
+
+void FNoesisRenderTargetPool::AddTexture(FPooledTexture&& Texture)
+{
+	Texture.Size = (uint64)CalcTextureSize(Texture.SizeX, Texture.SizeY, (EPixelFormat)Texture.Format, 1) * Texture.NumSamples;
+	if (Texture.ShaderResourceTexture.IsValid())
+	{
+		Texture.Size += CalcTextureSize(Texture.SizeX, Texture.SizeY, (EPixelFormat)Texture.Format, 1);
+	}
+	Texture.LastUsedFrame = GFrameNumberRenderThread;
+	AllocatedBytes += Texture.Size;
+
+	INC_DWORD_STAT(STAT_NoesisRenderTargetPoolAllocations);
+	INC_DWORD_STAT(STAT_NoesisRenderTargetPoolTextures);
+	INC_MEMORY_STAT_BY(STAT_NoesisRenderTargetPoolMemory, Texture.Size);
+
+	Textures.Add(MoveTemp(Texture));
+}
+
+void FNoesisRenderTargetPool::EvictUnusedTextures()
+{
+	// Textures handed out must already be referenced by the caller, so they aren't considered free
+	uint32 NumTexturesInUse = 0;
+	for (const FPooledTexture& Texture : Textures)
+	{
+		NumTexturesInUse += Texture.IsFree() ? 0 : 1;
+	}
+	SET_DWORD_STAT(STAT_NoesisRenderTargetPoolTexturesInUse, NumTexturesInUse);
+
+	if (BudgetBytes == 0)
+		return;
+
+	while (AllocatedBytes > BudgetBytes)
+	{
+		int32 OldestIndex = INDEX_NONE;
+		for (int32 Index = 0; Index < Textures.Num(); ++Index)
+		{
+			const FPooledTexture& Texture = Textures[Index];
+			if (Texture.IsFree() && (OldestIndex == INDEX_NONE || Texture.LastUsedFrame < Textures[OldestIndex].LastUsedFrame))
+			{
+				OldestIndex = Index;
+			}
+		}
+
+		if (OldestIndex == INDEX_NONE)
+			break;
+
+		AllocatedBytes -= Textures[OldestIndex].Size;
+		DEC_MEMORY_STAT_BY(STAT_NoesisRenderTargetPoolMemory, Textures[OldestIndex].Size);
+		DEC_DWORD_STAT(STAT_NoesisRenderTargetPoolTextures);
+		INC_DWORD_STAT(STAT_NoesisRenderTargetPoolEvictions);
+		Textures.RemoveAtSwap(OldestIndex);
+	}
+}
+
+void FNoesisRenderTargetPool::FindFreeRenderTarget(uint32 SizeX, uint32 SizeY, uint8 Format, uint32 NumSamples,
+	FTexture2DRHIRef& OutColorTarget, FTexture2DRHIRef& OutShaderResourceTexture)
+{
+	FPooledTexture* PooledTexture = FindFreeTexture(SizeX, SizeY, Format, NumSamples);
+	if (PooledTexture && PooledTexture->ShaderResourceTexture.IsValid())
+	{
+		PooledTexture->LastUsedFrame = GFrameNumberRenderThread;
+		INC_DWORD_STAT(STAT_NoesisRenderTargetPoolAllocationsAvoided);
+		OutColorTarget = PooledTexture->TargetableTexture;
+		OutShaderResourceTexture = PooledTexture->ShaderResourceTexture;
+		EvictUnusedTextures();
+		return;
+	}
+
+	uint32 NumMips = 1;
+	uint32 Flags = 0;
+	uint32 TargetableTextureFlags = (uint32)TexCreate_RenderTargetable;
+	bool bForceSeparateTargetAndShaderResource = true;
+	FRHIResourceCreateInfo CreateInfo;
+	RHICreateTargetableShaderResource2D(SizeX, SizeY, Format, NumMips, Flags, TargetableTextureFlags, bForceSeparateTargetAndShaderResource, CreateInfo, OutColorTarget, OutShaderResourceTexture, NumSamples);
+
+	FPooledTexture Texture;
+	Texture.SizeX = SizeX;
+	Texture.SizeY = SizeY;
+	Texture.Format = Format;
+	Texture.NumSamples = NumSamples;
+	Texture.TargetableTexture = OutColorTarget;
+	Texture.ShaderResourceTexture = OutShaderResourceTexture;
+	AddTexture(MoveTemp(Texture));
+	EvictUnusedTextures();
+}
+
+FTexture2DRHIRef FNoesisRenderTargetPool::FindFreeDepthStencil(uint32 SizeX, uint32 SizeY, uint32 NumSamples)
+{
+	uint8 Format = (uint8)PF_DepthStencil;
+	FPooledTexture* PooledTexture = FindFreeTexture(SizeX, SizeY, Format, NumSamples);
+	if (PooledTexture)
+	{
+		PooledTexture->LastUsedFrame = GFrameNumberRenderThread;
+		INC_DWORD_STAT(STAT_NoesisRenderTargetPoolAllocationsAvoided);
+		FTexture2DRHIRef DepthStencilTarget = PooledTexture->TargetableTexture;
+		EvictUnusedTextures();
+		return DepthStencilTarget;
+	}
+
+	uint32 NumMips = 1;
+	uint32 TargetableTextureFlags = (uint32)TexCreate_DepthStencilTargetable;
+	FRHIResourceCreateInfo CreateInfo;
+	CreateInfo.ClearValueBinding = FClearValueBinding(0.f, 0);
+	FTexture2DRHIRef DepthStencilTarget = RHICreateTexture2D(SizeX, SizeY, Format, NumMips, NumSamples, TargetableTextureFlags, CreateInfo);
+
+	FPooledTexture Texture;
+	Texture.SizeX = SizeX;
+	Texture.SizeY = SizeY;
+	Texture.Format = Format;
+	Texture.NumSamples = NumSamples;
+	Texture.TargetableTexture = DepthStencilTarget;
+	AddTexture(MoveTemp(Texture));
+	EvictUnusedTextures();
+
+	return DepthStencilTarget;
+}
+
+void FNoesisRenderTargetPool::ReleaseAll()
+{
+	DEC_MEMORY_STAT_BY(STAT_NoesisRenderTargetPoolMemory, AllocatedBytes);
+	SET_DWORD_STAT(STAT_NoesisRenderTargetPoolTextures, 0);
+	SET_DWORD_STAT(STAT_NoesisRenderTargetPoolTexturesInUse, 0);
+	Textures.Empty();
+	AllocatedBytes = 0;
+}
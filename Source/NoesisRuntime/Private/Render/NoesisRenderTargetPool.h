@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// RHI includes
+#include "RHI.h"
+#include "RHIResources.h"
+
+// Pool of render targets and depth-stencil surfaces shared by all the views. Textures are kept
+// alive by the pool and handed out again once nobody else holds a reference to them. Free textures
+// are evicted, least recently used first, when the pool grows over its memory budget.
+class FNoesisRenderTargetPool
+{
+public:
+	FNoesisRenderTargetPool();
+
+	void SetBudget(uint64 InBudgetBytes);
+
+	// Returns a color target and a separate texture it can be resolved to
+	void FindFreeRenderTarget(uint32 SizeX, uint32 SizeY, uint8 Format, uint32 NumSamples,
+		FTexture2DRHIRef& OutColorTarget, FTexture2DRHIRef& OutShaderResourceTexture);
+
+	FTexture2DRHIRef FindFreeDepthStencil(uint32 SizeX, uint32 SizeY, uint32 NumSamples);
+
+	void ReleaseAll();
+
+private:
+	struct FPooledTexture
+	{
+		uint32 SizeX;
+		uint32 SizeY;
+		uint8 Format;
+		uint32 NumSamples;
+		FTexture2DRHIRef TargetableTexture;
+		FTexture2DRHIRef ShaderResourceTexture;
+		uint64 Size;
+		uint32 LastUsedFrame;
+
+		bool IsFree() const;
+	};
+
+	FPooledTexture* FindFreeTexture(uint32 SizeX, uint32 SizeY, uint8 Format, uint32 NumSamples);
+	void AddTexture(FPooledTexture&& Texture);
+	void EvictUnusedTextures();
+
+	TArray<FPooledTexture> Textures;
+	uint64 BudgetBytes;
+	uint64 AllocatedBytes;
+};
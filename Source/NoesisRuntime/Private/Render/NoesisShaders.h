@@ -89,6 +89,44 @@ extern TGlobalResource<FNoesisPosTex0Tex1VertexDeclaration> GNoesisPosTex0Tex1Ve
 extern TGlobalResource<FNoesisPosColorTex1Tex2VertexDeclaration> GNoesisPosColorTex1Tex2VertexDeclaration;
 extern TGlobalResource<FNoesisPosTex0Tex1Tex2VertexDeclaration> GNoesisPosTex0Tex1Tex2VertexDeclaration;
 
+// Keeps a copy of the last value uploaded for a shader constant, so that batches that use the same
+// value as the previous one don't upload it again. The copy must be invalidated whenever a different
+// shader is bound, as the layout of the constants depends on the shader.
+template<uint32 MaxBytes>
+class TNoesisShaderConstantCache
+{
+public:
+	TNoesisShaderConstantCache()
+		: NumBytes(0), Valid(false)
+	{
+	}
+
+	void Invalidate()
+	{
+		Valid = false;
+	}
+
+	// Returns true if the value is different from the cached one, and so it needs to be uploaded
+	bool Update(const void* Value, uint32 Bytes)
+	{
+		check(Bytes <= MaxBytes);
+		if (Valid && NumBytes == Bytes && FMemory::Memcmp(Data, Value, Bytes) == 0)
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(Data, Value, Bytes);
+		NumBytes = Bytes;
+		Valid = true;
+		return true;
+	}
+
+private:
+	uint8 Data[MaxBytes];
+	uint32 NumBytes;
+	bool Valid;
+};
+
 class FNoesisVSBase : public FGlobalShader
 {
 public:
@@ -115,12 +153,15 @@ public:
 	}
 	*/
 
-	void SetParameters(FRHICommandList& RHICmdList, const FMatrix& ProjectionMtxValue, const float (*TextureSizeValue)[2])
+	void SetParameters(FRHICommandList& RHICmdList, const FMatrix* ProjectionMtxValue, const float (*TextureSizeValue)[2])
 	{
 		FRHIVertexShader* ShaderRHI = RHICmdList.GetBoundVertexShader();
 
-		check(ProjectionMtx.IsBound());
-		SetShaderValue(RHICmdList, ShaderRHI, ProjectionMtx, ProjectionMtxValue);
+		if (ProjectionMtxValue)
+		{
+			check(ProjectionMtx.IsBound());
+			SetShaderValue(RHICmdList, ShaderRHI, ProjectionMtx, *ProjectionMtxValue);
+		}
 
 		if (TextureSizeValue)
 		{
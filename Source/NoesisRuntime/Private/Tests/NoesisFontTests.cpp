@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Core includes
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/FileManager.h"
+
+// Engine includes
+#include "Engine/FontFace.h"
+
+// NoesisRuntime includes
+#include "NoesisResourceProvider.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Font faces shipped with the engine, DroidSansFallback is the CJK one
+static const TCHAR* const BenchmarkFontFaces[] =
+{
+	TEXT("/Engine/EngineFonts/Faces/DroidSansFallback.DroidSansFallback"),
+	TEXT("/Engine/EngineFonts/Faces/RobotoRegular.RobotoRegular"),
+	TEXT("/Engine/EngineFonts/Faces/RobotoBold.RobotoBold"),
+};
+
+// Reads the font header and a few tables spread over the file, as the font engine does to open a face and
+// rasterize a handful of glyphs
+static uint32 TouchFontStream(Noesis::Stream* Stream)
+{
+	uint32 Checksum = 0;
+	uint8 Buffer[4096];
+	uint32 Length = Stream->GetLength();
+	for (uint32 Offset = 0; Offset < Length; Offset += FMath::Max(Length / 16, (uint32)sizeof(Buffer)))
+	{
+		Stream->SetPosition(Offset);
+		uint32 Read = Stream->Read(Buffer, sizeof(Buffer));
+		for (uint32 Index = 0; Index < Read; Index += 64)
+		{
+			Checksum += Buffer[Index];
+		}
+	}
+	return Checksum;
+}
+
+static int64 GetUsedPhysical()
+{
+	return (int64)FPlatformMemory::GetStats().UsedPhysical;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisFontMemoryBenchmark, "Noesis.Font.MemoryBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNoesisFontMemoryBenchmark::RunTest(const FString& Parameters)
+{
+	// Views opening the same faces, each open used to hold its own copy
+	const int32 OpenCount = 4;
+
+	TArray<const UFontFace*> FontFaces;
+	int64 FontBytes = 0;
+	for (const TCHAR* FontFacePath : BenchmarkFontFaces)
+	{
+		const UFontFace* FontFace = LoadObject<UFontFace>(nullptr, FontFacePath);
+		if (FontFace)
+		{
+			FontFaces.Add(FontFace);
+			FontBytes += FontFace->GetLoadingPolicy() == EFontLoadingPolicy::Inline ? FontFace->FontFaceData->GetData().Num() : IFileManager::Get().FileSize(*FontFace->GetFontFilename());
+		}
+	}
+	if (FontFaces.Num() == 0)
+	{
+		AddWarning(TEXT("No engine font faces found"));
+		return true;
+	}
+
+	// Copies, as the font provider made them before
+	uint32 Checksum = 0;
+	int64 UsedBefore = GetUsedPhysical();
+	{
+		TArray<TArray<uint8> > Copies;
+		for (int32 Open = 0; Open != OpenCount; ++Open)
+		{
+			for (const UFontFace* FontFace : FontFaces)
+			{
+				TArray<uint8>& Copy = Copies.AddDefaulted_GetRef();
+				if (FontFace->GetLoadingPolicy() == EFontLoadingPolicy::Inline)
+				{
+					Copy = FontFace->FontFaceData->GetData();
+				}
+				else
+				{
+					FFileHelper::LoadFileToArray(Copy, *FontFace->GetFontFilename());
+				}
+				Noesis::Ptr<Noesis::Stream> Stream = *new Noesis::MemoryStream(Copy.GetData(), (uint32)Copy.Num());
+				Checksum += TouchFontStream(Stream);
+			}
+		}
+		int64 CopiedBytes = GetUsedPhysical() - UsedBefore;
+		AddInfo(FString::Printf(TEXT("%d faces (%.1f MB) opened %d times, copied: %.1f MB resident"), FontFaces.Num(), FontBytes / 1048576.0, OpenCount, CopiedBytes / 1048576.0));
+	}
+
+	UsedBefore = GetUsedPhysical();
+	{
+		TArray<Noesis::Ptr<Noesis::Stream> > Streams;
+		for (int32 Open = 0; Open != OpenCount; ++Open)
+		{
+			for (const UFontFace* FontFace : FontFaces)
+			{
+				Noesis::Ptr<Noesis::Stream> Stream = NoesisOpenFontFace(FontFace);
+				if (TestNotNull(TEXT("Font stream"), Stream.GetPtr()))
+				{
+					Checksum -= TouchFontStream(Stream);
+					Streams.Add(Stream);
+				}
+			}
+		}
+		int64 StreamBytes = GetUsedPhysical() - UsedBefore;
+		AddInfo(FString::Printf(TEXT("%d faces (%.1f MB) opened %d times, in place or mapped: %.1f MB resident"), FontFaces.Num(), FontBytes / 1048576.0, OpenCount, StreamBytes / 1048576.0));
+	}
+
+	TestEqual(TEXT("Streams read the same data as copies"), Checksum, 0u);
+
+	return true;
+}
+
+#endif
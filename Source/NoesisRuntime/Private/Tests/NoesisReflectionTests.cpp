@@ -0,0 +1,379 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Core includes
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Algo/Reverse.h"
+
+// CoreUObject includes
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+#include "UObject/TextProperty.h"
+
+// NoesisRuntime includes
+#include "NoesisTypeClass.h"
+#include "NoesisXaml.h"
+
+// Noesis includes
+#include "NoesisSDK.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// UNoesisXaml::Xamls is used as the bound array, its elements are wrapped UObjects with a stable identity
+static UNoesisXaml* CreateArrayOwner(int32 ElementCount)
+{
+	UNoesisXaml* Owner = NewObject<UNoesisXaml>(GetTransientPackage(), NAME_None, RF_Transient);
+	Owner->Xamls.Reserve(ElementCount);
+	for (int32 Index = 0; Index != ElementCount; ++Index)
+	{
+		Owner->Xamls.Add(NewObject<UNoesisXaml>(GetTransientPackage(), NAME_None, RF_Transient));
+	}
+	return Owner;
+}
+
+static void DestroyArrayOwner(UNoesisXaml* Owner)
+{
+	for (UNoesisXaml* Element : Owner->Xamls)
+	{
+		Element->MarkPendingKill();
+	}
+	Owner->MarkPendingKill();
+}
+
+// Applies the collection events to its own copy of the list, as an ItemsControl does with its containers
+class FNoesisCollectionListener
+{
+public:
+	FNoesisCollectionListener(UNoesisXaml* Owner)
+	{
+		Wrapper = NoesisCreateComponentForUObject(Owner);
+		const Noesis::TypeProperty* XamlsProperty = Wrapper->GetClassType()->FindProperty(Noesis::Symbol("Xamls"));
+		Array = XamlsProperty->GetComponent(Wrapper.GetPtr());
+		List = Noesis::DynamicCast<Noesis::IList*>(Array.GetPtr());
+		Noesis::DynamicCast<Noesis::INotifyCollectionChanged*>(Array.GetPtr())->CollectionChanged() += Noesis::MakeDelegate(this, &FNoesisCollectionListener::OnCollectionChanged);
+		Reset();
+	}
+
+	~FNoesisCollectionListener()
+	{
+		Noesis::DynamicCast<Noesis::INotifyCollectionChanged*>(Array.GetPtr())->CollectionChanged() -= Noesis::MakeDelegate(this, &FNoesisCollectionListener::OnCollectionChanged);
+	}
+
+	void Reset()
+	{
+		Items.Reset();
+		for (int32 Index = 0; Index != List->Count(); ++Index)
+		{
+			Items.Add(List->GetComponent(Index));
+		}
+		ItemEvents = 0;
+		Resets = 0;
+	}
+
+	bool MatchesList() const
+	{
+		if (Items.Num() != List->Count())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index != Items.Num(); ++Index)
+		{
+			if (Items[Index] != List->GetComponent(Index))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void OnCollectionChanged(Noesis::BaseComponent*, const Noesis::NotifyCollectionChangedEventArgs& Args)
+	{
+		switch (Args.action)
+		{
+		case Noesis::NotifyCollectionChangedAction_Add:
+			Items.Insert(Noesis::Ptr<Noesis::BaseComponent>(Args.newValue), Args.newStartingIndex);
+			++ItemEvents;
+			break;
+		case Noesis::NotifyCollectionChangedAction_Remove:
+			Items.RemoveAt(Args.oldStartingIndex);
+			++ItemEvents;
+			break;
+		case Noesis::NotifyCollectionChangedAction_Move:
+		{
+			Noesis::Ptr<Noesis::BaseComponent> Item = Items[Args.oldStartingIndex];
+			Items.RemoveAt(Args.oldStartingIndex);
+			Items.Insert(Item, Args.newStartingIndex);
+			++ItemEvents;
+			break;
+		}
+		case Noesis::NotifyCollectionChangedAction_Reset:
+			Items.Reset();
+			for (int32 Index = 0; Index != List->Count(); ++Index)
+			{
+				Items.Add(List->GetComponent(Index));
+			}
+			++Resets;
+			break;
+		default:
+			break;
+		}
+	}
+
+	Noesis::Ptr<Noesis::BaseComponent> Wrapper;
+	Noesis::Ptr<Noesis::BaseComponent> Array;
+	Noesis::IList* List;
+	TArray<Noesis::Ptr<Noesis::BaseComponent> > Items;
+	int32 ItemEvents;
+	int32 Resets;
+};
+
+static void ReorderArray(TArray<UNoesisXaml*>& Array, const TArray<int32>& NewToOldIndices)
+{
+	TArray<UNoesisXaml*> Reordered;
+	Reordered.Reserve(Array.Num());
+	for (int32 OldIndex : NewToOldIndices)
+	{
+		Reordered.Add(Array[OldIndex]);
+	}
+	Array = MoveTemp(Reordered);
+	NoesisNotifyArrayPropertyPostReorder(&Array, NewToOldIndices);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisArrayChangeBenchmark, "Noesis.Reflection.ArrayChangeBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNoesisArrayChangeBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 ElementCount = 2000;
+
+	UNoesisXaml* Owner = CreateArrayOwner(ElementCount);
+	{
+		FNoesisCollectionListener Listener(Owner);
+
+		TArray<int32> NewToOldIndices;
+		for (int32 Index = 0; Index != ElementCount; ++Index)
+		{
+			NewToOldIndices.Add(Index);
+		}
+
+		// The first item moved to the back is a single Move, not one for each item it passes
+		NewToOldIndices.RemoveAt(0);
+		NewToOldIndices.Add(0);
+		double StartTime = FPlatformTime::Seconds();
+		ReorderArray(Owner->Xamls, NewToOldIndices);
+		double MoveToBackTime = FPlatformTime::Seconds() - StartTime;
+		TestEqual(TEXT("Move to back events"), Listener.ItemEvents, 1);
+		TestEqual(TEXT("Move to back resets"), Listener.Resets, 0);
+		TestTrue(TEXT("Move to back order"), Listener.MatchesList());
+
+		// A reversed block of 32 items is 31 moves
+		Listener.Reset();
+		for (int32 Index = 0; Index != ElementCount; ++Index)
+		{
+			NewToOldIndices[Index] = Index;
+		}
+		Algo::Reverse(NewToOldIndices.GetData() + 100, 32);
+		StartTime = FPlatformTime::Seconds();
+		ReorderArray(Owner->Xamls, NewToOldIndices);
+		double ReverseBlockTime = FPlatformTime::Seconds() - StartTime;
+		TestEqual(TEXT("Reversed block events"), Listener.ItemEvents, 31);
+		TestTrue(TEXT("Reversed block order"), Listener.MatchesList());
+
+		// Reversing the whole array is a Reset
+		Listener.Reset();
+		for (int32 Index = 0; Index != ElementCount; ++Index)
+		{
+			NewToOldIndices[Index] = ElementCount - 1 - Index;
+		}
+		StartTime = FPlatformTime::Seconds();
+		ReorderArray(Owner->Xamls, NewToOldIndices);
+		double ReverseTime = FPlatformTime::Seconds() - StartTime;
+		TestEqual(TEXT("Reverse events"), Listener.ItemEvents, 0);
+		TestEqual(TEXT("Reverse resets"), Listener.Resets, 1);
+		TestTrue(TEXT("Reverse order"), Listener.MatchesList());
+
+		// Ranges are item events when small and a Reset when large
+		for (int32 RangeCount : { 8, 500 })
+		{
+			Listener.Reset();
+			int32 Index = Owner->Xamls.Num() / 2;
+			for (int32 Offset = 0; Offset != RangeCount; ++Offset)
+			{
+				Owner->Xamls.Insert(NewObject<UNoesisXaml>(GetTransientPackage(), NAME_None, RF_Transient), Index + Offset);
+			}
+			StartTime = FPlatformTime::Seconds();
+			NoesisNotifyArrayPropertyPostAddRange(&Owner->Xamls, Index, RangeCount);
+			double InsertTime = FPlatformTime::Seconds() - StartTime;
+			TestEqual(FString::Printf(TEXT("Insert %d events"), RangeCount), Listener.ItemEvents + Listener.Resets, RangeCount <= 64 ? RangeCount : 1);
+			TestTrue(FString::Printf(TEXT("Insert %d order"), RangeCount), Listener.MatchesList());
+
+			Listener.Reset();
+			StartTime = FPlatformTime::Seconds();
+			NoesisNotifyArrayPropertyPreRemoveRange(&Owner->Xamls, Index, RangeCount);
+			Owner->Xamls.RemoveAt(Index, RangeCount);
+			NoesisNotifyArrayPropertyPostRemoveRange(&Owner->Xamls, Index);
+			double RemoveTime = FPlatformTime::Seconds() - StartTime;
+			TestEqual(FString::Printf(TEXT("Remove %d events"), RangeCount), Listener.ItemEvents + Listener.Resets, RangeCount <= 64 ? RangeCount : 1);
+			TestTrue(FString::Printf(TEXT("Remove %d order"), RangeCount), Listener.MatchesList());
+
+			AddInfo(FString::Printf(TEXT("Insert %d of %d: %.3f ms, remove: %.3f ms"), RangeCount, ElementCount, InsertTime * 1000.0, RemoveTime * 1000.0));
+		}
+
+		AddInfo(FString::Printf(TEXT("Reorder of %d, move to back: %.3f ms"), ElementCount, MoveToBackTime * 1000.0));
+		AddInfo(FString::Printf(TEXT("Reorder of %d, reversed block: %.3f ms"), ElementCount, ReverseBlockTime * 1000.0));
+		AddInfo(FString::Printf(TEXT("Reorder of %d, reversed: %.3f ms"), ElementCount, ReverseTime * 1000.0));
+	}
+	DestroyArrayOwner(Owner);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisReverseLookupBenchmark, "Noesis.Reflection.ReverseLookupBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNoesisReverseLookupBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 LookupCount = 100000;
+
+	TArray<UNoesisXaml*> Objects;
+	TArray<Noesis::Ptr<Noesis::BaseComponent> > Wrappers;
+	TArray<Noesis::Ptr<Noesis::BaseComponent> > Elements;
+	for (int32 ObjectCount : { 100, 1000, 10000 })
+	{
+		while (Objects.Num() != ObjectCount)
+		{
+			UNoesisXaml* Object = NewObject<UNoesisXaml>(GetTransientPackage(), NAME_None, RF_Transient);
+			Objects.Add(Object);
+			Wrappers.Add(NoesisCreateComponentForUObject(Object));
+			Elements.Add(Noesis::Ptr<Noesis::BaseComponent>(*new Noesis::Grid()));
+		}
+
+		// Wrapped UObjects, found through ComponentMap
+		bool Found = true;
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Lookup = 0; Lookup != LookupCount; ++Lookup)
+		{
+			int32 Index = (Lookup * 7919) % ObjectCount;
+			Found &= NoesisCreateUObjectForComponent(Wrappers[Index].GetPtr()) == Objects[Index];
+		}
+		double WrapperSeconds = FPlatformTime::Seconds() - StartTime;
+		TestTrue(FString::Printf(TEXT("Wrapped objects found with %d objects"), ObjectCount), Found);
+
+		// Native components, the first lookup creates their proxy and the others find it in ComponentProxyMap
+		for (const Noesis::Ptr<Noesis::BaseComponent>& Element : Elements)
+		{
+			NoesisCreateUObjectForComponent(Element.GetPtr());
+		}
+		UObject* FirstProxy = NoesisCreateUObjectForComponent(Elements[0].GetPtr());
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Lookup = 0; Lookup != LookupCount; ++Lookup)
+		{
+			NoesisCreateUObjectForComponent(Elements[(Lookup * 7919) % ObjectCount].GetPtr());
+		}
+		double ProxySeconds = FPlatformTime::Seconds() - StartTime;
+		TestEqual(FString::Printf(TEXT("Proxy reused with %d objects"), ObjectCount), NoesisCreateUObjectForComponent(Elements[0].GetPtr()), FirstProxy);
+
+		AddInfo(FString::Printf(TEXT("%d objects: %.1f ns per wrapper lookup, %.1f ns per proxy lookup"), ObjectCount,
+			WrapperSeconds * 1.0e9 / LookupCount, ProxySeconds * 1.0e9 / LookupCount));
+	}
+
+	Wrappers.Empty();
+	Elements.Empty();
+	for (UNoesisXaml* Object : Objects)
+	{
+		Object->MarkPendingKill();
+	}
+
+	return true;
+}
+
+// A ViewModel class like the ones made in Blueprints: fields of the usual types and a couple of structs
+static UClass* CreateViewModelClass(int32 Index, int32 FieldCount)
+{
+	UClass* Class = NewObject<UClass>(GetTransientPackage(), *FString::Printf(TEXT("NoesisBenchmarkViewModel%d"), Index), RF_Transient);
+	Class->SetSuperStruct(UObject::StaticClass());
+
+	for (int32 Field = FieldCount; Field-- > 0;)
+	{
+		FName FieldName(*FString::Printf(TEXT("Field%d"), Field));
+		UProperty* Property = nullptr;
+		switch (Field % 7)
+		{
+		case 0:
+			Property = NewObject<UIntProperty>(Class, FieldName, RF_Transient);
+			break;
+		case 1:
+			Property = NewObject<UFloatProperty>(Class, FieldName, RF_Transient);
+			break;
+		case 2:
+		{
+			UBoolProperty* BoolProperty = NewObject<UBoolProperty>(Class, FieldName, RF_Transient);
+			BoolProperty->SetBoolSize(sizeof(bool), true);
+			Property = BoolProperty;
+			break;
+		}
+		case 3:
+			Property = NewObject<UStrProperty>(Class, FieldName, RF_Transient);
+			break;
+		case 4:
+			Property = NewObject<UTextProperty>(Class, FieldName, RF_Transient);
+			break;
+		case 5:
+		{
+			UStructProperty* StructProperty = NewObject<UStructProperty>(Class, FieldName, RF_Transient);
+			StructProperty->Struct = TBaseStructure<FColor>::Get();
+			Property = StructProperty;
+			break;
+		}
+		default:
+		{
+			UObjectProperty* ObjectProperty = NewObject<UObjectProperty>(Class, FieldName, RF_Transient);
+			ObjectProperty->PropertyClass = UObject::StaticClass();
+			Property = ObjectProperty;
+			break;
+		}
+		}
+		Property->SetPropertyFlags(CPF_Edit | CPF_BlueprintVisible);
+		Class->AddCppProperty(Property);
+	}
+
+	Class->Bind();
+	Class->StaticLink(true);
+	Class->AssembleReferenceTokenStream();
+	return Class;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisTypeClassBenchmark, "Noesis.Reflection.TypeClassBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNoesisTypeClassBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 ClassCount = 1000;
+	const int32 FieldCount = 28;
+
+	TArray<UClass*> Classes;
+	for (int32 Index = 0; Index != ClassCount; ++Index)
+	{
+		Classes.Add(CreateViewModelClass(Index, FieldCount));
+	}
+
+	bool Filled = true;
+	double StartTime = FPlatformTime::Seconds();
+	for (UClass* Class : Classes)
+	{
+		Noesis::TypeClass* TypeClass = NoesisCreateTypeClassForUClass(Class);
+		Filled &= TypeClass != nullptr && TypeClass->FindProperty(Noesis::Symbol("Field0")) != nullptr;
+	}
+	double Seconds = FPlatformTime::Seconds() - StartTime;
+	TestTrue(TEXT("Type classes filled"), Filled);
+
+	AddInfo(FString::Printf(TEXT("%d classes of %d fields: %.3f ms total, %.1f us per class"), ClassCount, FieldCount,
+		Seconds * 1000.0, Seconds * 1.0e6 / ClassCount));
+
+	return true;
+}
+
+#endif
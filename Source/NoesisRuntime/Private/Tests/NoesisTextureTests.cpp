@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Core includes
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+// CoreUObject includes
+#include "UObject/Package.h"
+
+// Engine includes
+#include "Engine/Texture2D.h"
+
+// RenderCore includes
+#include "RenderingThread.h"
+
+// NoesisRuntime includes
+#include "NoesisResourceProvider.h"
+#include "NoesisSupport.h"
+#include "Render/NoesisRenderDevice.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisBlockCompressedTexturesTest, "Noesis.Render.BlockCompressedTextures",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FNoesisBlockCompressedTexturesTest::RunTest(const FString& Parameters)
+{
+	struct FFormatCase
+	{
+		EPixelFormat PixelFormat;
+		Noesis::TextureFormat::Enum Format;
+	};
+	static const FFormatCase FormatCases[] =
+	{
+		{ PF_DXT1, Noesis::TextureFormat::RGBA8 },
+		{ PF_DXT3, Noesis::TextureFormat::RGBA8 },
+		{ PF_DXT5, Noesis::TextureFormat::RGBA8 },
+		{ PF_BC4, Noesis::TextureFormat::R8 },
+		{ PF_BC5, Noesis::TextureFormat::RGBA8 },
+		{ PF_BC6H, Noesis::TextureFormat::RGBA8 },
+		{ PF_BC7, Noesis::TextureFormat::RGBA8 },
+		{ PF_ASTC_4x4, Noesis::TextureFormat::RGBA8 },
+		{ PF_ASTC_6x6, Noesis::TextureFormat::RGBA8 },
+		{ PF_ASTC_8x8, Noesis::TextureFormat::RGBA8 },
+		{ PF_ASTC_10x10, Noesis::TextureFormat::RGBA8 },
+		{ PF_ASTC_12x12, Noesis::TextureFormat::RGBA8 },
+	};
+
+	// A multiple of every block size above
+	const int32 TextureSize = 120;
+
+	FNoesisTextureProvider* NoesisTextureProvider = new FNoesisTextureProvider();
+	Noesis::TextureProvider* TextureProvider = NoesisTextureProvider;
+
+	for (const FFormatCase& FormatCase : FormatCases)
+	{
+		const TCHAR* FormatName = GPixelFormats[FormatCase.PixelFormat].Name;
+
+		Noesis::TextureFormat::Enum Format;
+		TestTrue(FString::Printf(TEXT("%s is a known format"), FormatName), FNoesisRenderDevice::GetTextureFormat(FormatCase.PixelFormat, Format));
+		TestEqual(FString::Printf(TEXT("%s texture format"), FormatName), (int32)Format, (int32)FormatCase.Format);
+
+		// The NullRHI creates textures of any format, the other RHIs only the ones the platform supports
+		if (!GUsingNullRHI && !GPixelFormats[FormatCase.PixelFormat].Supported)
+		{
+			continue;
+		}
+
+		FString PackageName = FString::Printf(TEXT("/Engine/Transient/NoesisTextureTest_%s"), FormatName);
+		UPackage* Package = CreatePackage(nullptr, *PackageName);
+		Package->SetFlags(RF_Transient);
+
+		UTexture2D* Texture = UTexture2D::CreateTransient(TextureSize, TextureSize, FormatCase.PixelFormat);
+		if (!TestNotNull(FString::Printf(TEXT("%s texture"), FormatName), Texture))
+		{
+			continue;
+		}
+		Texture->Rename(*FPackageName::GetShortName(PackageName), Package, REN_DontCreateRedirectors | REN_NonTransactional);
+		Texture->NeverStream = true;
+		Texture->UpdateResource();
+		FlushRenderingCommands();
+
+		Noesis::String TexturePath = TCHARToNsString(*PackageName);
+		Noesis::TextureInfo TextureInfo = TextureProvider->GetTextureInfo(TexturePath.Str());
+		TestEqual(FString::Printf(TEXT("%s texture info width"), FormatName), (int32)TextureInfo.width, TextureSize);
+		TestEqual(FString::Printf(TEXT("%s texture info height"), FormatName), (int32)TextureInfo.height, TextureSize);
+
+		Noesis::Ptr<Noesis::Texture> NoesisTexture = TextureProvider->LoadTexture(TexturePath.Str(), nullptr);
+		if (TestNotNull(FString::Printf(TEXT("%s Noesis texture"), FormatName), NoesisTexture.GetPtr()))
+		{
+			TestEqual(FString::Printf(TEXT("%s Noesis texture width"), FormatName), (int32)NoesisTexture->GetWidth(), TextureSize);
+			TestEqual(FString::Printf(TEXT("%s Noesis texture height"), FormatName), (int32)NoesisTexture->GetHeight(), TextureSize);
+		}
+		NoesisTexture.Reset();
+
+		Texture->ReleaseResource();
+		Texture->MarkPendingKill();
+	}
+
+	delete NoesisTextureProvider;
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisTextureStagingBenchmark, "Noesis.Render.TextureStagingBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNoesisTextureStagingBenchmark::RunTest(const FString& Parameters)
+{
+	// A glyph cache filled as text is first shown: shelves of glyphs, some cells left empty
+	const uint32 TextureSize = 1024;
+	const uint32 GlyphSize = 32;
+	const uint32 GlyphRows = 8;
+
+	uint32 GlyphCount = 0;
+	uint32 PeakStagingBytes = 0;
+	double UpdateSeconds = 0.0;
+	double FlushSeconds = 0.0;
+	ENQUEUE_RENDER_COMMAND(FNoesisTextureStagingBenchmark)
+	(
+		[&](FRHICommandListImmediate& RHICmdList)
+		{
+			FNoesisRenderDevice* RenderDevice = FNoesisRenderDevice::Get();
+			Noesis::Ptr<Noesis::Texture> Texture = RenderDevice->CreateTexture("NoesisTextureStagingBenchmark", TextureSize, TextureSize, 1, Noesis::TextureFormat::R8, nullptr);
+
+			TArray<uint8> Glyph;
+			Glyph.Init(0xff, GlyphSize * GlyphSize);
+
+			double StartTime = FPlatformTime::Seconds();
+			for (uint32 Row = 0; Row != GlyphRows; ++Row)
+			{
+				for (uint32 Column = 0; Column != TextureSize / GlyphSize; ++Column)
+				{
+					if ((Row + Column) % 5 != 0)
+					{
+						RenderDevice->UpdateTexture(Texture, 0, Column * GlyphSize, Row * GlyphSize, GlyphSize, GlyphSize, Glyph.GetData());
+						PeakStagingBytes = FMath::Max(PeakStagingBytes, RenderDevice->GetTextureStagingBytes());
+						++GlyphCount;
+					}
+				}
+			}
+			UpdateSeconds = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			RenderDevice->BeginRender(false);
+			RenderDevice->EndRender();
+			FlushSeconds = FPlatformTime::Seconds() - StartTime;
+		}
+	);
+	FlushRenderingCommands();
+
+	TestEqual(TEXT("Staging bytes after flush"), (int32)FNoesisRenderDevice::Get()->GetTextureStagingBytes(), 0);
+	TestTrue(TEXT("Peak staging bytes within the updated glyphs"), PeakStagingBytes <= GlyphCount * GlyphSize * GlyphSize);
+
+	AddInfo(FString::Printf(TEXT("%u glyphs of %ux%u: %.1f KB updated, %.1f KB staged at peak, %.1f KB for a full mip copy"),
+		GlyphCount, GlyphSize, GlyphSize, GlyphCount * GlyphSize * GlyphSize / 1024.0, PeakStagingBytes / 1024.0, TextureSize * TextureSize / 1024.0));
+	AddInfo(FString::Printf(TEXT("Updates: %.3f ms, flush: %.3f ms"), UpdateSeconds * 1000.0, FlushSeconds * 1000.0));
+
+	return true;
+}
+
+#endif
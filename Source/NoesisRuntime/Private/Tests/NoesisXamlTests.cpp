@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// NoesisGUI - http://www.noesisengine.com
+// Copyright (c) 2013 Noesis Technologies S.L. All Rights Reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Core includes
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+// CoreUObject includes
+#include "UObject/Package.h"
+
+// RenderCore includes
+#include "RenderingThread.h"
+
+// NoesisRuntime includes
+#include "NoesisXaml.h"
+#include "NoesisSettings.h"
+#include "Render/NoesisRenderDevice.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static UNoesisXaml* CreateTestXaml(const TCHAR* Name, const FString& Text)
+{
+	FString PackageName = FString::Printf(TEXT("/Engine/Transient/%s"), Name);
+	UPackage* Package = CreatePackage(nullptr, *PackageName);
+	Package->SetFlags(RF_Transient);
+
+	UNoesisXaml* Xaml = NewObject<UNoesisXaml>(Package, Name, RF_Transient);
+	FTCHARToUTF8 Utf8Text(*Text);
+	Xaml->XamlText.Append((const uint8*)Utf8Text.Get(), Utf8Text.Length());
+	return Xaml;
+}
+
+// A list item like the ones instantiated for every entry of an inventory or a server browser
+static FString GetItemXaml(int32 RowCount)
+{
+	FString Xaml = TEXT("<StackPanel xmlns=\"http://schemas.microsoft.com/winfx/2006/xaml/presentation\" xmlns:x=\"http://schemas.microsoft.com/winfx/2006/xaml\">");
+	for (int32 Row = 0; Row != RowCount; ++Row)
+	{
+		Xaml += FString::Printf(TEXT("<Border Background=\"#FF202020\" BorderBrush=\"#FF808080\" BorderThickness=\"1\" Margin=\"2\"><Grid><Grid.ColumnDefinitions><ColumnDefinition Width=\"Auto\"/><ColumnDefinition/></Grid.ColumnDefinitions>")
+			TEXT("<TextBlock x:Name=\"Label%d\" Text=\"Label %d\" Margin=\"4\"/><TextBlock Grid.Column=\"1\" Text=\"Value %d\" HorizontalAlignment=\"Right\"/></Grid></Border>"), Row, Row, Row);
+	}
+	Xaml += TEXT("</StackPanel>");
+	return Xaml;
+}
+
+static double MeasureInstancesPerSecond(FAutomationTestBase& Test, UNoesisXaml* Xaml, int32 InstanceCount)
+{
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Instance = 0; Instance != InstanceCount; ++Instance)
+	{
+		Noesis::Ptr<Noesis::FrameworkElement> Root = Xaml->InstantiateXaml();
+		if (!Test.TestNotNull(TEXT("Instantiated XAML"), Root.GetPtr()))
+		{
+			return 0.0;
+		}
+	}
+	return InstanceCount / FMath::Max(FPlatformTime::Seconds() - StartTime, SMALL_NUMBER);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisXamlInstantiationBenchmark, "Noesis.Xaml.InstantiationBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNoesisXamlInstantiationBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 InstanceCount = 200;
+
+	UNoesisXaml* Xaml = CreateTestXaml(TEXT("NoesisXamlInstantiationBenchmark"), GetItemXaml(20));
+	UNoesisSettings* Settings = GetMutableDefault<UNoesisSettings>();
+	int32 XamlTemplateCacheBudget = Settings->XamlTemplateCacheBudget;
+
+	UNoesisXaml::ClearTemplateCache();
+	Settings->XamlTemplateCacheBudget = 0;
+	double ParsedPerSecond = MeasureInstancesPerSecond(*this, Xaml, InstanceCount);
+
+	Settings->XamlTemplateCacheBudget = FMath::Max(XamlTemplateCacheBudget, 1024);
+	double ClonedPerSecond = MeasureInstancesPerSecond(*this, Xaml, InstanceCount);
+
+	Settings->XamlTemplateCacheBudget = XamlTemplateCacheBudget;
+	UNoesisXaml::ClearTemplateCache();
+	Xaml->MarkPendingKill();
+
+	AddInfo(FString::Printf(TEXT("Parsed: %.0f instances/s"), ParsedPerSecond));
+	AddInfo(FString::Printf(TEXT("Template cache: %.0f instances/s"), ClonedPerSecond));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisXamlTemplateCacheTest, "Noesis.Xaml.TemplateCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FNoesisXamlTemplateCacheTest::RunTest(const FString& Parameters)
+{
+	static const TCHAR XamlFormat[] = TEXT("<Grid xmlns=\"http://schemas.microsoft.com/winfx/2006/xaml/presentation\" xmlns:x=\"http://schemas.microsoft.com/winfx/2006/xaml\"><TextBlock x:Name=\"%s\"/></Grid>");
+
+	UNoesisXaml* Xaml = CreateTestXaml(TEXT("NoesisXamlTemplateCacheTest"), FString::Printf(XamlFormat, TEXT("Before")));
+	UNoesisSettings* Settings = GetMutableDefault<UNoesisSettings>();
+	int32 XamlTemplateCacheBudget = Settings->XamlTemplateCacheBudget;
+	Settings->XamlTemplateCacheBudget = FMath::Max(XamlTemplateCacheBudget, 1024);
+	UNoesisXaml::ClearTemplateCache();
+
+	// Parsed, then cloned from the template
+	for (int32 Instance = 0; Instance != 2; ++Instance)
+	{
+		Noesis::Ptr<Noesis::FrameworkElement> Root = Xaml->InstantiateXaml();
+		if (TestNotNull(TEXT("Instantiated XAML"), Root.GetPtr()))
+		{
+			TestNotNull(TEXT("Named element"), Root->FindName("Before"));
+		}
+	}
+
+	// A reimport changes the content under the same path, its instances must not come from the old template
+	FTCHARToUTF8 Utf8Text(*FString::Printf(XamlFormat, TEXT("After")));
+	Xaml->XamlText.Reset();
+	Xaml->XamlText.Append((const uint8*)Utf8Text.Get(), Utf8Text.Length());
+	for (int32 Instance = 0; Instance != 2; ++Instance)
+	{
+		Noesis::Ptr<Noesis::FrameworkElement> Root = Xaml->InstantiateXaml();
+		if (TestNotNull(TEXT("Reimported XAML"), Root.GetPtr()))
+		{
+			TestNotNull(TEXT("Reimported named element"), Root->FindName("After"));
+			TestNull(TEXT("Previous named element"), Root->FindName("Before"));
+		}
+	}
+
+	Settings->XamlTemplateCacheBudget = XamlTemplateCacheBudget;
+	UNoesisXaml::ClearTemplateCache();
+	Xaml->MarkPendingKill();
+
+	return true;
+}
+
+// A localized menu: rows of CJK text, each row using characters no other row does
+static FString GetMenuXaml(TCHAR FirstCharacter, int32 RowCount, int32 RowLength, float FontSize)
+{
+	FString Xaml = FString::Printf(TEXT("<StackPanel xmlns=\"http://schemas.microsoft.com/winfx/2006/xaml/presentation\" TextElement.FontSize=\"%s\">"), *FString::SanitizeFloat(FontSize));
+	for (int32 Row = 0; Row != RowCount; ++Row)
+	{
+		FString Text;
+		for (int32 Column = 0; Column != RowLength; ++Column)
+		{
+			Text.AppendChar((TCHAR)(FirstCharacter + Row * RowLength + Column));
+		}
+		Xaml += FString::Printf(TEXT("<TextBlock Text=\"%s\"/>"), *Text);
+	}
+	Xaml += TEXT("</StackPanel>");
+	return Xaml;
+}
+
+static FNoesisGlyphSet GetMenuGlyphSet(TCHAR FirstCharacter, int32 CharacterCount, float FontSize)
+{
+	FNoesisGlyphSet GlyphSet;
+	GlyphSet.FontSize = FontSize;
+	for (int32 Index = 0; Index != CharacterCount; ++Index)
+	{
+		GlyphSet.Characters.AppendChar((TCHAR)(FirstCharacter + Index));
+	}
+	return GlyphSet;
+}
+
+// Time from instantiating the XAML to its first frame drawn on the GPU
+static double MeasureFirstFrameSeconds(UNoesisXaml* Xaml, uint32 Size)
+{
+	double StartTime = FPlatformTime::Seconds();
+	Noesis::Ptr<Noesis::FrameworkElement> Root = Xaml->InstantiateXaml();
+	Noesis::Ptr<Noesis::IView> View = Noesis::GUI::CreateView(Root);
+	View->SetSize(Size, Size);
+	View->Update(0.0);
+
+	Noesis::Ptr<Noesis::IRenderer> Renderer(View->GetRenderer());
+	ENQUEUE_RENDER_COMMAND(FNoesisFirstFrameBenchmark)
+	(
+		[Renderer, Size](FRHICommandListImmediate& RHICmdList)
+		{
+			FNoesisRenderDevice* RenderDevice = FNoesisRenderDevice::Get();
+			Renderer->Init(RenderDevice);
+			FNoesisRenderDevice::ThreadLocal_SetRHICmdList(&RHICmdList);
+			Renderer->UpdateRenderTree();
+			Renderer->RenderOffscreen();
+
+			FTexture2DRHIRef ColorTarget;
+			FTexture2DRHIRef ShaderResourceTexture;
+			RenderDevice->RenderTargetPool.FindFreeRenderTarget(Size, Size, PF_B8G8R8A8, 1, ColorTarget, ShaderResourceTexture);
+			FTexture2DRHIRef DepthStencilTarget = RenderDevice->RenderTargetPool.FindFreeDepthStencil(Size, Size, 1);
+			FRHIRenderPassInfo RPInfo(ColorTarget, ERenderTargetActions::DontLoad_DontStore, DepthStencilTarget,
+				MakeDepthStencilTargetActions(ERenderTargetActions::DontLoad_DontStore, ERenderTargetActions::Clear_DontStore), FExclusiveDepthStencil::DepthNop_StencilWrite);
+
+			RHICmdList.BeginRenderPass(RPInfo, TEXT("NoesisFirstFrameBenchmark"));
+			RHICmdList.SetViewport(0, 0, 0.0f, Size, Size, 1.0f);
+			Renderer->Render(false);
+			RHICmdList.EndRenderPass();
+
+			FNoesisRenderDevice::ThreadLocal_SetRHICmdList(nullptr);
+			Renderer->Shutdown();
+		}
+	);
+	FlushRenderingCommands();
+	return FPlatformTime::Seconds() - StartTime;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNoesisGlyphPrewarmBenchmark, "Noesis.Xaml.GlyphPrewarmBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FNoesisGlyphPrewarmBenchmark::RunTest(const FString& Parameters)
+{
+	// More characters than fit a single prewarm pass at this size
+	const int32 RowCount = 100;
+	const int32 RowLength = 40;
+	const float FontSize = 24.f;
+	const uint32 ViewSize = 1024;
+
+	// Disjoint CJK ranges, so the glyphs of one menu aren't cached by the other
+	const TCHAR ColdCharacter = (TCHAR)0x4E00;
+	const TCHAR PrewarmedCharacter = (TCHAR)(0x4E00 + RowCount * RowLength);
+
+	UNoesisXaml* ColdXaml = CreateTestXaml(TEXT("NoesisGlyphPrewarmBenchmarkCold"), GetMenuXaml(ColdCharacter, RowCount, RowLength, FontSize));
+	double ColdSeconds = MeasureFirstFrameSeconds(ColdXaml, ViewSize);
+
+	UNoesisXaml* PrewarmedXaml = CreateTestXaml(TEXT("NoesisGlyphPrewarmBenchmarkPrewarmed"), GetMenuXaml(PrewarmedCharacter, RowCount, RowLength, FontSize));
+	PrewarmedXaml->GlyphSets.Add(GetMenuGlyphSet(PrewarmedCharacter, RowCount * RowLength, FontSize));
+	double StartTime = FPlatformTime::Seconds();
+	PrewarmedXaml->PrewarmGlyphs();
+	FlushRenderingCommands();
+	double PrewarmSeconds = FPlatformTime::Seconds() - StartTime;
+	double PrewarmedSeconds = MeasureFirstFrameSeconds(PrewarmedXaml, ViewSize);
+
+	ColdXaml->MarkPendingKill();
+	PrewarmedXaml->MarkPendingKill();
+
+	AddInfo(FString::Printf(TEXT("%d characters at %.0f px, first frame: %.3f ms without prewarm, %.3f ms with prewarm"),
+		RowCount * RowLength, FontSize, ColdSeconds * 1000.0, PrewarmedSeconds * 1000.0));
+	AddInfo(FString::Printf(TEXT("Prewarm: %.3f ms"), PrewarmSeconds * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -11,6 +11,9 @@
 #include "Stats/Stats.h"
 #include "Stats/Stats2.h"
 
+// CoreUObject includes
+#include "UObject/SoftObjectPath.h"
+
 DECLARE_LOG_CATEGORY_EXTERN(LogNoesis, VeryVerbose, All);
 
 DECLARE_STATS_GROUP(TEXT("Noesis"), STATGROUP_Noesis, STATCAT_Advanced);
@@ -27,6 +30,12 @@ class NOESISRUNTIME_API INoesisRuntimeModuleInterface : public IModuleInterface
 {
 public:
 	static INoesisRuntimeModuleInterface& Get();
+	static bool IsAvailable();
 
 	virtual void RegisterFont(class UFont* Font) = 0;
+	// Sizes are reference counted, each registration must be matched by an unregistration
+	virtual void RegisterTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size) = 0;
+	virtual void UnregisterTextureSize(const FSoftObjectPath& TexturePath) = 0;
+	// Changes the size of a texture already registered, after it was reimported
+	virtual void UpdateTextureSize(const FSoftObjectPath& TexturePath, FIntPoint Size) = 0;
 };
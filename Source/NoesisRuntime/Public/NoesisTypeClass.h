@@ -48,6 +48,50 @@ NOESISRUNTIME_API void NoesisNotifyArrayPropertyPostRemove(void*, int32);
 NOESISRUNTIME_API void NoesisNotifyArrayPropertyPostClear(void*);
 NOESISRUNTIME_API void NoesisNotifyArrayPropertyPreSet(void*, int32);
 NOESISRUNTIME_API void NoesisNotifyArrayPropertyPostSet(void*, int32);
-NOESISRUNTIME_API void NoesisGarbageCollected();
+NOESISRUNTIME_API void NoesisNotifyArrayPropertyPostAddRange(void*, int32, int32);
+NOESISRUNTIME_API void NoesisNotifyArrayPropertyPreRemoveRange(void*, int32, int32);
+NOESISRUNTIME_API void NoesisNotifyArrayPropertyPostRemoveRange(void*, int32);
+NOESISRUNTIME_API void NoesisNotifyArrayPropertyPostSwap(void*, int32, int32);
+NOESISRUNTIME_API void NoesisNotifyArrayPropertyPostReorder(void*, const TArray<int32>&);
+NOESISRUNTIME_API void NoesisFlushPropertyChanges();
+
+// Counts the changes notified to the objects and arrays a view is bound to. A view is made current while it
+// updates, which is when its bindings subscribe to the change events of the wrappers
+class FNoesisViewChanges : public TSharedFromThis<FNoesisViewChanges, ESPMode::ThreadSafe>
+{
+public:
+	FThreadSafeCounter ChangeCount;
+};
+
+// Returns the previous one, to be restored once the view is done
+NOESISRUNTIME_API FNoesisViewChanges* NoesisSetCurrentViewChanges(FNoesisViewChanges*);
+
+// Sorts an array bound to a view and notifies the reordering as Move events, so item containers are kept.
+// Sorts that move most of the items are raised as a Reset
+template<class T, class PredicateType>
+void NoesisSortArray(TArray<T>& Array, PredicateType Predicate)
+{
+	TArray<int32> NewToOldIndices;
+	NewToOldIndices.SetNumUninitialized(Array.Num());
+	for (int32 Index = 0; Index != Array.Num(); ++Index)
+	{
+		NewToOldIndices[Index] = Index;
+	}
+	NewToOldIndices.StableSort([&Array, &Predicate](int32 A, int32 B) { return Predicate(Array[A], Array[B]); });
+
+	TArray<T> Sorted;
+	Sorted.Reserve(Array.Num());
+	for (int32 OldIndex : NewToOldIndices)
+	{
+		Sorted.Add(MoveTemp(Array[OldIndex]));
+	}
+	Array = MoveTemp(Sorted);
+
+	NoesisNotifyArrayPropertyPostReorder(&Array, NewToOldIndices);
+}
+
 void NoesisReflectionRegistryCallback(Noesis::Symbol TypeId);
 void NoesisRegisterTypes();
+void NoesisUnregisterTypes();
+void NoesisRegisterObjectDeleteListener();
+void NoesisUnregisterObjectDeleteListener();